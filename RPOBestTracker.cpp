@@ -0,0 +1,36 @@
+/*
+ * RPOBestTracker.cpp
+ *
+ * File defining the methods of the class RPOBestTracker.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#include <RPOBestTracker.h>
+
+void RPOBestTracker::track(RPOSolution &best, RPOSolution &current){
+	_best = &best;
+	_current = &current;
+	_best->copy(current);
+	_bestFitness = current.getFitness();
+	_pending = false;
+	_logParams.clear();
+	_logValues.clear();
+	_maxLog = current.getSetofParameters().size();
+	_logParams.reserve(_maxLog);
+	_logValues.reserve(_maxLog);
+}
+
+void RPOBestTracker::materialise(){
+	_best->copy(*_current);
+
+	//The oldest value of a parameter changed several times is the last one restored
+	for (size_t i = _logParams.size(); i > 0; i--)
+		_best->ChangeParameterTo(_logParams[i - 1], _logValues[i - 1]);
+	_best->setFitness(_bestFitness);
+
+	_pending = false;
+	_logParams.clear();
+	_logValues.clear();
+}
@@ -0,0 +1,45 @@
+/*
+ * RPOEvaluationContext.cpp
+ *
+ * File defining the methods of the class RPOEvaluationContext.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#include <RPOEvaluationContext.h>
+
+thread_local RPOEvaluationContext *RPOEvaluationContext::_current = NULL;
+
+RPOEvaluationContext::RPOEvaluationContext(){
+	resetNumEvaluations();
+	_cache = current()._cache;
+}
+
+RPOEvaluationContext::RPOEvaluationContext(RPOFitnessCache *cache){
+	resetNumEvaluations();
+	_cache = cache;
+}
+
+unsigned RPOEvaluationContext::shard(){
+	static atomic<unsigned> nextShard(0);
+	static thread_local unsigned index = nextShard.fetch_add(1, memory_order_relaxed) % NUM_SHARDS;
+	return index;
+}
+
+RPOEvaluationContext &RPOEvaluationContext::current(){
+	static RPOEvaluationContext processContext(NULL);
+	return (_current != NULL) ? *_current : processContext;
+}
+
+unsigned long RPOEvaluationContext::getNumEvaluations() const{
+	unsigned long numEvaluations = 0;
+	for (unsigned i = 0; i < NUM_SHARDS; i++)
+		numEvaluations += _shards[i].count.load(memory_order_relaxed);
+	return numEvaluations;
+}
+
+void RPOEvaluationContext::resetNumEvaluations(){
+	for (unsigned i = 0; i < NUM_SHARDS; i++)
+		_shards[i].count.store(0, memory_order_relaxed);
+}
@@ -11,29 +11,103 @@
 #include <RPOEvaluator.h>
 #include <RPOInstance.h>
 #include <RPOSolution.h>
-
-unsigned RPOEvaluator::_numEvaluations = 0;
+#include <RPOProfiler.h>
 
 double RPOEvaluator::computeFitness(RPOInstance &instance, RPOSolution &solution){
-	double fitness=instance.getFitness(solution);
+	RPO_PROFILE_EVALUATION(EVALUATOR, FULL, instance.getFunctionNumber(), 1);
+	RPOEvaluationContext &context = RPOEvaluationContext::current();
+	RPOFitnessCache *cache = context._cache;
+	double fitness;
+	if (cache != NULL){
+		cache->setInstance(instance);
+		if (cache->lookup(solution.getParameters(), -1, 0, fitness)){
+			if (cache->hitsCountAsEvaluations())
+				context.addEvaluations(1);
+			return fitness;
+		}
+	}
+
+	context.addEvaluations(1);
+	fitness=instance.getFitness(solution);
+	if (cache != NULL)
+		cache->insert(solution.getParameters(), -1, 0, fitness);
 	return fitness;
 }
 
 double RPOEvaluator::computeDeltaFitness(RPOInstance& instance,
 										  RPOSolution& solution, int indexParam, int newParamValue) {
 
-	_numEvaluations++;
-
+	RPO_PROFILE_EVALUATION(EVALUATOR, DELTA, instance.getFunctionNumber(), 1);
+	RPOEvaluationContext &context = RPOEvaluationContext::current();
+	RPOFitnessCache *cache = context._cache;
 	double oldFitness=solution.getFitness();
-	double oldParamValue=solution.parameterValue(indexParam);
-	solution.ChangeParameterTo(indexParam,newParamValue);
-	double newFitness=instance.getFitness(solution);
-	solution.ChangeParameterTo(indexParam,oldParamValue);
+	double newFitness;
+	if (cache != NULL){
+		cache->setInstance(instance);
+		if (cache->lookup(solution.getParameters(), indexParam, newParamValue, newFitness)){
+			if (cache->hitsCountAsEvaluations())
+				context.addEvaluations(1);
+			return newFitness-oldFitness;
+		}
+	}
+
+	context.addEvaluations(1);
+
+	newFitness=instance.getFitness(solution, indexParam, newParamValue);
+	if (cache != NULL)
+		cache->insert(solution.getParameters(), indexParam, newParamValue, newFitness);
 	return newFitness-oldFitness;
 }
 
+void RPOEvaluator::computeDeltaFitnessSweep(RPOInstance &instance, RPOSolution &solution, int indexParam,
+											 vector<double> &deltaFitness, bool countEvaluations){
+
+	RPO_PROFILE_EVALUATION(EVALUATOR, SWEEP, instance.getFunctionNumber(), instance.getLengthD(indexParam)-1);
+	double oldFitness=solution.getFitness();
+	instance.getFitnessSweep(solution, indexParam, deltaFitness);
+	for (unsigned value = 0; value < deltaFitness.size(); value++)
+		deltaFitness[value]-=oldFitness;
+	deltaFitness[solution.parameterValue(indexParam)]=0;
+	if (countEvaluations)
+		RPOEvaluationContext::current().addEvaluations(deltaFitness.size()-1);
+}
+
+void RPOEvaluator::computeFitnessBatch(RPOInstance &instance, vector<RPOSolution*> &solutions, vector<double> &fitness){
+	RPO_PROFILE_EVALUATION(EVALUATOR, BATCH, instance.getFunctionNumber(), solutions.size());
+	RPOEvaluationContext &context = RPOEvaluationContext::current();
+	RPOFitnessCache *cache = context._cache;
+	if (cache == NULL){
+		context.addEvaluations(solutions.size());
+		instance.getFitness(solutions, fitness);
+		return;
+	}
+
+	//Only the solutions which are not in the cache are evaluated
+	vector<RPOSolution*> &misses = context._misses;
+	vector<unsigned> &missIndices = context._missIndices;
+	vector<double> &missFitness = context._missFitness;
+	cache->setInstance(instance);
+	fitness.resize(solutions.size());
+	misses.clear();
+	missIndices.clear();
+	for (unsigned i = 0; i < solutions.size(); i++)
+		if (!cache->lookup(solutions[i]->getParameters(), -1, 0, fitness[i])){
+			misses.push_back(solutions[i]);
+			missIndices.push_back(i);
+		}
+
+	context.addEvaluations(cache->hitsCountAsEvaluations() ? solutions.size() : misses.size());
+	if (misses.empty())
+		return;
+	instance.getFitness(misses, missFitness);
+	for (unsigned i = 0; i < misses.size(); i++){
+		fitness[missIndices[i]] = missFitness[i];
+		cache->insert(misses[i]->getParameters(), -1, 0, missFitness[i]);
+	}
+}
+
 void RPOEvaluator::resetNumEvaluations() {
-	_numEvaluations = 0;
+	RPOEvaluationContext::current().resetNumEvaluations();
 }
 
 
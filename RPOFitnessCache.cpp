@@ -0,0 +1,126 @@
+/*
+ * RPOFitnessCache.cpp
+ *
+ * File defining the methods of the class RPOFitnessCache.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#include <RPOFitnessCache.h>
+#include <RPOInstance.h>
+
+RPOFitnessCache::RPOFitnessCache(unsigned numEntries, bool hitsCountAsEvaluations){
+	unsigned size = PROBE_LENGTH;
+	while (size < numEntries)
+		size *= 2;
+	_mask = size - 1;
+	_numParams = 0;
+	_hitsCount = hitsCountAsEvaluations;
+	_instanceId = 0;
+	_hash.resize(size);
+	_fitness.resize(size);
+	_used.assign(size, 0);
+	_ref.assign(size, 0);
+	_hand = 0;
+	resetStatistics();
+}
+
+void RPOFitnessCache::setInstance(RPOInstance &instance){
+	if (_instanceId == instance.getId())
+		return;
+
+	_instanceId = instance.getId();
+	clear();
+	if (_numParams == instance.getNumParameters())
+		return;
+
+	_numParams = instance.getNumParameters();
+	_keys.resize((size_t) (_mask + 1) * _numParams);
+
+	//Random numbers of the fingerprints (splitmix64, so that the sequence of rand() is not altered)
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	_zobrist.resize((size_t) _numParams * 256);
+	for (size_t i = 0; i < _zobrist.size(); i++){
+		uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		_zobrist[i] = z ^ (z >> 31);
+	}
+}
+
+bool RPOFitnessCache::fingerprint(const RPOGene *parameters, int indexParam, int newParamValue, uint64_t &h) const{
+	h = 0;
+	for (int i = 0; i < _numParams; i++){
+		unsigned value = (i == indexParam) ? newParamValue : parameters[i];
+		if (value > 255)
+			return false;
+		h ^= _zobrist[i * 256 + value];
+	}
+	return true;
+}
+
+bool RPOFitnessCache::sameKey(unsigned entry, const RPOGene *parameters, int indexParam, int newParamValue) const{
+	const unsigned char *key = &_keys[(size_t) entry * _numParams];
+	for (int i = 0; i < _numParams; i++)
+		if (key[i] != ((i == indexParam) ? newParamValue : parameters[i]))
+			return false;
+	return true;
+}
+
+bool RPOFitnessCache::lookup(const RPOGene *parameters, int indexParam, int newParamValue, double &fitness){
+	uint64_t h;
+	if (_instanceId != 0 && fingerprint(parameters, indexParam, newParamValue, h))
+		for (unsigned k = 0; k < PROBE_LENGTH; k++){
+			unsigned entry = (h + k) & _mask;
+			if (!_used[entry])
+				break;
+			if (_hash[entry] == h && sameKey(entry, parameters, indexParam, newParamValue)){
+				_ref[entry] = 1;
+				fitness = _fitness[entry];
+				_hits++;
+				return true;
+			}
+		}
+	_misses++;
+	return false;
+}
+
+void RPOFitnessCache::insert(const RPOGene *parameters, int indexParam, int newParamValue, double fitness){
+	uint64_t h;
+	if (_instanceId == 0 || !fingerprint(parameters, indexParam, newParamValue, h))
+		return;
+
+	//Entry of the solution, or first free entry of the window
+	unsigned entry = 0, k;
+	for (k = 0; k < PROBE_LENGTH; k++){
+		entry = (h + k) & _mask;
+		if (!_used[entry] || (_hash[entry] == h && sameKey(entry, parameters, indexParam, newParamValue)))
+			break;
+	}
+
+	//The window is full: CLOCK replacement (the hand clears the reference bits until it finds an entry without it)
+	if (k == PROBE_LENGTH){
+		for (;;){
+			entry = (h + _hand) & _mask;
+			_hand = (_hand + 1) % PROBE_LENGTH;
+			if (!_ref[entry])
+				break;
+			_ref[entry] = 0;
+		}
+		_evictions++;
+	}
+
+	unsigned char *key = &_keys[(size_t) entry * _numParams];
+	for (int i = 0; i < _numParams; i++)
+		key[i] = (unsigned char) ((i == indexParam) ? newParamValue : parameters[i]);
+	_hash[entry] = h;
+	_fitness[entry] = fitness;
+	_used[entry] = 1;
+	_ref[entry] = 0;
+}
+
+void RPOFitnessCache::clear(){
+	_used.assign(_used.size(), 0);
+	_ref.assign(_ref.size(), 0);
+}
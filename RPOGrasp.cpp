@@ -70,13 +70,12 @@ void RPOGrasp::chooseOperation(RPOObjectAssignmentOperation& operation) {
 void RPOGrasp::buildInitialSolution() {
 
 	/**
-	 * Empty the solution _sol assigning a 0 fitness to it and establishing a 0
+	 * Empty the solution _sol (reusing its memory) assigning a 0 fitness to it and establishing a 0
 	 * for the knapsacks of all objects
 	 */
 	unsigned numParam = _instance->getNumParameters();
 
-	delete _sol;
-	_sol=new RPOSolution(*_instance);
+	_sol->reset(*_instance);
 
 	/** Choose the first operation */
 	RPOObjectAssignmentOperation operation;
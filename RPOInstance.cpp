@@ -10,18 +10,67 @@
 
 #include "RPOInstance.h"
 #include "RPOSolution.h"
+#include "RPOProfiler.h"
+#include <atomic>
 
-RPOInstance::RPOInstance(int size_param,int numfunc): func(size_param,numfunc) {
-	_numParameters=func.getNumParameters();
+template<class Objective>
+RPOBasicInstance<Objective>::~RPOBasicInstance() {
 }
 
-RPOInstance::~RPOInstance() {
+template<class Objective>
+unsigned long RPOBasicInstance<Objective>::newId(){
+	//The instances can be created by several threads
+	static std::atomic<unsigned long> lastId(0);
+	return ++lastId;
 }
 
-double RPOInstance::getFitness(RPOSolution &solution){
-	return func.fitness(solution.getSetofParameters());
+template<class Objective>
+typename Objective::State &RPOBasicInstance<Objective>::state(RPOSolution &solution){
+	return static_cast<typename Objective::State&>(solution.getEvalState());
 }
-void RPOInstance::randomPermutation(int numParam, vector<int>& perm) {
+
+template<class Objective>
+double RPOBasicInstance<Objective>::getFitness(RPOSolution &solution){
+	RPO_PROFILE_EVALUATION(OBJECTIVE, FULL, func.getFunctionNumber(), 1);
+	return func.fitness(solution.getParameters());
+}
+
+template<class Objective>
+void RPOBasicInstance<Objective>::computeInitialFitness(){
+	vector<RPOGene> zeros(_numParameters, 0);
+	_initialFitness = func.fitness(&zeros[0]);
+}
+
+template<class Objective>
+double RPOBasicInstance<Objective>::getFitness(RPOSolution &solution, int indexParam, int newParamValue){
+	RPO_PROFILE_EVALUATION(OBJECTIVE, DELTA, func.getFunctionNumber(), 1);
+	return func.fitnessDelta(solution.getParameters(), state(solution), indexParam, newParamValue);
+}
+
+template<class Objective>
+void RPOBasicInstance<Objective>::getFitnessSweep(RPOSolution &solution, int indexParam, vector<double> &fitness){
+	RPO_PROFILE_EVALUATION(OBJECTIVE, SWEEP, func.getFunctionNumber(), getLengthD(indexParam)-1);
+	func.fitnessSweep(solution.getParameters(), state(solution), indexParam, fitness);
+}
+
+template<class Objective>
+vector<const RPOGene*> &RPOBasicInstance<Objective>::batchParameters(){
+	static thread_local vector<const RPOGene*> parameters;
+	return parameters;
+}
+
+template<class Objective>
+void RPOBasicInstance<Objective>::getFitness(const vector<RPOSolution*> &solutions, vector<double> &fitness) const{
+	RPO_PROFILE_EVALUATION(OBJECTIVE, BATCH, func.getFunctionNumber(), solutions.size());
+	vector<const RPOGene*> &parameters = batchParameters();
+	parameters.clear();
+	for (RPOSolution *sol : solutions)
+		parameters.push_back(sol->getParameters());
+	func.fitnessBatch(parameters, fitness);
+}
+
+template<class Objective>
+void RPOBasicInstance<Objective>::randomPermutation(int numParam, vector<int>& perm) {
 	perm.clear();
 	//we have to initialise it
 	perm.resize(numParam);
@@ -42,3 +91,6 @@ void RPOInstance::randomPermutation(int numParam, vector<int>& perm) {
 	return;
 
 }
+
+//Instance used by the metaheuristics
+template class RPOBasicInstance<RPO_OBJECTIVE>;
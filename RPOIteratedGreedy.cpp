@@ -25,6 +25,7 @@ void RPOIteratedGreedy::chooseOperation(
 	double bestDeltaFitness = 0;
 	bool initialisedBestDensity = false;
 	unsigned numParam = _instance->getNumParameters();;
+	vector<double> deltas;
 
 	/**
 	 *
@@ -40,6 +41,7 @@ void RPOIteratedGreedy::chooseOperation(
 
 		if (_sol->parameterValue(indexParam) == 0) { //check that it is not in a knapsack
 
+			RPOEvaluator::computeDeltaFitnessSweep(*_instance, *_sol, indexParam, deltas);
 			for (unsigned j = 0 ; j < _instance->getLengthD(indexParam); j++) { //for all the available knapsacks (do not consider 0)
 
 				//Obtain delta fitness and density (deltaFitness divided by weight)
@@ -47,7 +49,7 @@ void RPOIteratedGreedy::chooseOperation(
 				if(newValue==_sol->parameterValue(indexParam))
 					continue;
 
-				double deltaFitness = RPOEvaluator::computeDeltaFitness(*_instance, *_sol, indexParam, newValue);
+				double deltaFitness = deltas[newValue];
 				double density = deltaFitness / fabs(_sol->parameterValue(indexParam)-newValue);
 
 				//update the best values if they are improved
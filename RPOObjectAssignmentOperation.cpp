@@ -23,9 +23,9 @@ void RPOObjectAssignmentOperation::apply(RPOSolution& solution) {
 	/* 1. Assign the index _indexObj to the knapsack _indexKnapsack in solution
 	 * 2. Update the fitness of the solution increasing it by _deltaFitness
 	 */
-	solution.ChangeParameterTo(_indexParam, _paramValue);
 	double actualFitness = solution.getFitness();
 	double newFitness = actualFitness + _deltaFitness;
+	solution.ChangeParameterTo(_indexParam, _paramValue);
 	solution.setFitness(newFitness);
 }
 
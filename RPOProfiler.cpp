@@ -0,0 +1,182 @@
+/*
+ * RPOProfiler.cpp
+ *
+ * File defining the methods of the class RPOProfiler.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#include <RPOProfiler.h>
+
+#ifdef RPO_PROFILE
+
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+/* Statistics of a thread. They are never freed, so the ones of the finished threads are dumped too */
+struct ProfileData {
+	RPOProfiler::Stats byFunction[RPOProfiler::NUM_LAYERS][RPOProfiler::NUM_KINDS][RPOProfiler::MAX_FUNCTIONS];
+	RPOProfiler::Stats byCaller[RPOProfiler::NUM_KINDS][RPOProfiler::NUM_CALLERS];
+	unsigned long runs[RPOProfiler::NUM_CALLERS];
+	unsigned long long runNs[RPOProfiler::NUM_CALLERS], evaluationNs[RPOProfiler::NUM_CALLERS];
+};
+
+const char *LAYER_NAMES[RPOProfiler::NUM_LAYERS] = {"evaluator", "objective"};
+const char *KIND_NAMES[RPOProfiler::NUM_KINDS] = {"full", "delta", "sweep", "batch"};
+const char *CALLER_NAMES[RPOProfiler::NUM_CALLERS] = {"other", "RS", "LS", "SA", "TS", "GRASP", "IG", "GA", "ACO"};
+
+mutex profileMutex;
+vector<ProfileData*> profileThreads;
+thread_local ProfileData *profileData = NULL;
+thread_local int profileCaller = RPOProfiler::CALLER_OTHER;
+
+ProfileData &threadData(){
+	if (profileData == NULL){
+		profileData = new ProfileData;
+		memset(profileData, 0, sizeof(ProfileData));
+		lock_guard<mutex> lock(profileMutex);
+		profileThreads.push_back(profileData);
+	}
+	return *profileData;
+}
+
+void add(RPOProfiler::Stats &s, unsigned long numSolutions, unsigned long long ns){
+	int b = 0;
+	while (b < RPOProfiler::NUM_BUCKETS - 1 && (ns >> b) != 0)
+		b++;
+	s.calls++;
+	s.solutions += numSolutions;
+	s.ns += ns;
+	s.buckets[b]++;
+}
+
+void merge(RPOProfiler::Stats &to, const RPOProfiler::Stats &from){
+	to.calls += from.calls;
+	to.solutions += from.solutions;
+	to.ns += from.ns;
+	for (int b = 0; b < RPOProfiler::NUM_BUCKETS; b++)
+		to.buckets[b] += from.buckets[b];
+}
+
+void write(ostream &out, const RPOProfiler::Stats &s){
+	out << "\"calls\": " << s.calls << ", \"solutions\": " << s.solutions << ", \"total_ns\": " << s.ns
+		<< ", \"mean_ns\": " << (s.calls > 0 ? s.ns / s.calls : 0) << ", \"histogram_ns\": {";
+	bool first = true;
+	for (int b = 0; b < RPOProfiler::NUM_BUCKETS; b++)
+		if (s.buckets[b] > 0){
+			out << (first ? "" : ", ") << "\"" << (b > 0 ? 1ULL << (b - 1) : 0ULL) << "\": " << s.buckets[b];
+			first = false;
+		}
+	out << "}";
+}
+
+}
+
+RPOProfiler::RunScope::RunScope(int caller){
+	_caller = caller;
+	_previous = profileCaller;
+	profileCaller = caller;
+	_start = std::chrono::steady_clock::now();
+}
+
+RPOProfiler::RunScope::~RunScope(){
+	ProfileData &data = threadData();
+	data.runs[_caller]++;
+	data.runNs[_caller] += elapsed(_start);
+	profileCaller = _previous;
+}
+
+void RPOProfiler::record(int layer, int kind, int function, unsigned long numSolutions, unsigned long long ns){
+	ProfileData &data = threadData();
+	if (function < 0 || function >= MAX_FUNCTIONS)
+		function = 0;
+	add(data.byFunction[layer][kind][function], numSolutions, ns);
+	if (layer == EVALUATOR){
+		add(data.byCaller[kind][profileCaller], numSolutions, ns);
+		data.evaluationNs[profileCaller] += ns;
+	}
+}
+
+void RPOProfiler::dump(ostream &out){
+	ProfileData total;
+	memset(&total, 0, sizeof(total));
+	{
+		lock_guard<mutex> lock(profileMutex);
+		for (ProfileData *data : profileThreads){
+			for (int l = 0; l < NUM_LAYERS; l++)
+				for (int k = 0; k < NUM_KINDS; k++)
+					for (int f = 0; f < MAX_FUNCTIONS; f++)
+						merge(total.byFunction[l][k][f], data->byFunction[l][k][f]);
+			for (int k = 0; k < NUM_KINDS; k++)
+				for (int c = 0; c < NUM_CALLERS; c++)
+					merge(total.byCaller[k][c], data->byCaller[k][c]);
+			for (int c = 0; c < NUM_CALLERS; c++){
+				total.runs[c] += data->runs[c];
+				total.runNs[c] += data->runNs[c];
+				total.evaluationNs[c] += data->evaluationNs[c];
+			}
+		}
+	}
+
+	out << "{" << endl;
+	for (int l = 0; l < NUM_LAYERS; l++){
+		out << "  \"" << LAYER_NAMES[l] << "\": [";
+		bool first = true;
+		for (int k = 0; k < NUM_KINDS; k++)
+			for (int f = 0; f < MAX_FUNCTIONS; f++)
+				if (total.byFunction[l][k][f].calls > 0){
+					out << (first ? "" : ",") << endl << "    {\"kind\": \"" << KIND_NAMES[k] << "\", \"function\": " << f << ", ";
+					write(out, total.byFunction[l][k][f]);
+					out << "}";
+					first = false;
+				}
+		out << endl << "  ]," << endl;
+	}
+
+	//Time of the runs of each caller, split into evaluations and the rest (the overhead of the metaheuristic)
+	out << "  \"callers\": [";
+	bool first = true;
+	for (int c = 0; c < NUM_CALLERS; c++){
+		bool used = total.runs[c] > 0;
+		for (int k = 0; k < NUM_KINDS; k++)
+			used = used || total.byCaller[k][c].calls > 0;
+		if (!used)
+			continue;
+		unsigned long long overhead = (total.runNs[c] > total.evaluationNs[c]) ? total.runNs[c] - total.evaluationNs[c] : 0;
+		out << (first ? "" : ",") << endl << "    {\"caller\": \"" << CALLER_NAMES[c] << "\", \"runs\": " << total.runs[c]
+			<< ", \"run_ns\": " << total.runNs[c] << ", \"evaluation_ns\": " << total.evaluationNs[c]
+			<< ", \"overhead_ns\": " << overhead << ", \"kinds\": {";
+		bool firstKind = true;
+		for (int k = 0; k < NUM_KINDS; k++)
+			if (total.byCaller[k][c].calls > 0){
+				out << (firstKind ? "" : ", ") << "\"" << KIND_NAMES[k] << "\": {";
+				write(out, total.byCaller[k][c]);
+				out << "}";
+				firstKind = false;
+			}
+		out << "}}";
+		first = false;
+	}
+	out << endl << "  ]" << endl << "}" << endl;
+}
+
+void RPOProfiler::dump(){
+	const char *fileName = getenv("RPO_PROFILE_FILE");
+	ofstream out((fileName != NULL) ? fileName : "rpo_profile.json");
+	if (!out.is_open()){
+		cerr << "Error: Cannot open the profile file for writing" << endl;
+		return;
+	}
+	dump(out);
+}
+
+#endif
@@ -32,6 +32,7 @@ bool RPOSimpleBestImprovementNO::findOperation(RPOInstance& instance,
 	instance.randomPermutation(numParam,perm);
 	bool initialised = false;
 	double bestDeltaFitness = 0;
+	vector<double> deltas;
 
 	for( int i=0;i<numParam;i++)
 	{
@@ -55,9 +56,13 @@ bool RPOSimpleBestImprovementNO::findOperation(RPOInstance& instance,
 		}*/
 		int minValue=0;
 		int maxValue=instance.getLengthD(paramIndex)-1;
+		//Every value, the current one included, is counted as an evaluation, as with
+		//computeDeltaFitness (and as first improvement counts the values it scans)
+		RPOEvaluator::computeDeltaFitnessSweep(instance, solution, paramIndex, deltas, false);
+		RPOEvaluator::addEvaluations(maxValue-minValue+1);
 		for(int value=minValue;value<=maxValue;value++)
 		{
-			double deltaFitness = RPOEvaluator::computeDeltaFitness(instance, solution,paramIndex, value);
+			double deltaFitness = deltas[value];
 			if(deltaFitness>bestDeltaFitness)
 			{
 				bestDeltaFitness=deltaFitness;
@@ -26,6 +26,7 @@ bool RPOSimpleFirstImprovementNO::findOperation(RPOInstance &instance, RPOSoluti
 
 	//Create a permutation of the indices of the objects and initialize some variables
 	vector<int> perm;
+	vector<double> deltas;
 	int numParam = instance.getNumParameters();
 	instance.randomPermutation(numParam,perm);
 	for(int i=0; i<numParam; i++){
@@ -49,13 +50,18 @@ bool RPOSimpleFirstImprovementNO::findOperation(RPOInstance &instance, RPOSoluti
 		}*/
 		int minValue=0;
 		int maxValue=instance.getLengthD(paramIndex)-1;
+		//Only the values scanned until the first improvement are counted as evaluations, one for each
+		//value as with computeDeltaFitness
+		RPOEvaluator::computeDeltaFitnessSweep(instance, solution, paramIndex, deltas, false);
 		for(int j=minValue;j<=maxValue;j++){
-			double deltaFitness=RPOEvaluator::computeDeltaFitness(instance,solution,paramIndex,j);
+			double deltaFitness=deltas[j];
 			if(deltaFitness>0){
+				RPOEvaluator::addEvaluations(j-minValue+1);
 				oaOperation->setValues(paramIndex,j,deltaFitness);
 				return true;
 			}
 		}
+		RPOEvaluator::addEvaluations(maxValue-minValue+1);
 	}
 	return false;
 	/*
@@ -35,7 +35,7 @@ void RPOSimulatedAnnealing::setSolution(RPOSolution* solution) {
 		_bestSolution = new RPOSolution(*_instance);
 	}
 
-	_bestSolution->copy(*solution);
+	_bestTracker.track(*_bestSolution, *solution);
 }
 
 void RPOSimulatedAnnealing::run(RPOStopCondition& stopCondition) {
@@ -69,11 +69,13 @@ void RPOSimulatedAnnealing::run(RPOStopCondition& stopCondition) {
 		int paramValue = rand() % (_instance->getLengthD(indexParam));
 		double deltaFitness =RPOEvaluator::computeDeltaFitness(*_instance,*_solution,indexParam,paramValue);
 		if (accept(deltaFitness)){
+			double newFitness = _solution->getFitness() + deltaFitness;
+			_bestTracker.notifyChange(indexParam);
 			_solution->ChangeParameterTo(indexParam, paramValue);
-			_solution->setFitness(_solution->getFitness() + deltaFitness);
+			_solution->setFitness(newFitness);
 
-			if (RPOEvaluator::compare(_solution->getFitness(), _bestSolution->getFitness()) > 0){
-				_bestSolution->copy(*_solution);
+			if (RPOEvaluator::compare(_solution->getFitness(), _bestTracker.getFitness()) > 0){
+				_bestTracker.update();
 			}
 		}
 		numIterations++;
@@ -85,6 +87,10 @@ void RPOSimulatedAnnealing::run(RPOStopCondition& stopCondition) {
 
 		stopCondition.notifyIteration();
 	}
+
+	//Build the best solution in _bestSolution, as _solution belongs to the caller and can be
+	//changed after the run
+	_bestTracker.getSolution();
 }
 
 bool RPOSimulatedAnnealing::accept(double deltaFitness) {
@@ -130,16 +136,29 @@ void RPOSimulatedAnnealing::initialise(double initialProb, int numInitialEstimat
 	 *   worse solutions
 	 */
 
+	//The random solutions are generated first and evaluated all together
+	vector<RPOSolution*> sols;
+	vector<int> indexParams, paramValues;
+	vector<double> fitness;
+
 	for (int i = 0; i < numInitialEstimates; i++){
-		RPOSolution sol(instance);
-		RPOSolGenerator::genRandomSol(instance, sol);
+		RPOSolution *sol = new RPOSolution(instance);
+		RPOSolGenerator::genRandomParameters(instance, *sol);
+		sols.push_back(sol);
 		int indexParam = rand() % numParam;
-		int paramValue = rand() % (_instance->getLengthD(indexParam));
-		double deltaFitness =RPOEvaluator::computeDeltaFitness(*_instance,sol,indexParam,paramValue);
+		indexParams.push_back(indexParam);
+		paramValues.push_back(rand() % (_instance->getLengthD(indexParam)));
+	}
+	RPOEvaluator::computeFitnessBatch(instance, sols, fitness);
+
+	for (int i = 0; i < numInitialEstimates; i++){
+		sols[i]->setFitness(fitness[i]);
+		double deltaFitness =RPOEvaluator::computeDeltaFitness(*_instance,*sols[i],indexParams[i],paramValues[i]);
 		averageFDiffs += max(fabs(deltaFitness),10.);
 		//There is a minimum difference of 10 to avoid fitness changes too small
 		//(for example, when a knapsack is modified and it is not the one leading to
 		// maximum violation) (this method could be improved)
+		delete sols[i];
 	}
 
 	averageFDiffs /= numInitialEstimates;
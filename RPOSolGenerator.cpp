@@ -15,12 +15,17 @@
 
 void RPOSolGenerator::genRandomSol(RPOInstance &instance,RPOSolution &solution){
 
+	genRandomParameters(instance, solution);
+	solution.setFitness(RPOEvaluator::computeFitness(instance,solution));
+}
+
+void RPOSolGenerator::genRandomParameters(RPOInstance &instance,RPOSolution &solution){
+
 	int numParam = instance.getNumParameters();
 
 	for (int i = 0; i < numParam; i++){
 		int randomValue = (rand() % (instance.getLengthD(i)));
 		solution.ChangeParameterTo(i, randomValue);
 	}
-	solution.setFitness(RPOEvaluator::computeFitness(instance,solution));
 }
 
@@ -10,23 +10,49 @@
 
 #include "RPOSolution.h"
 #include "RPOInstance.h"
+#include "RPOEvalState.h"
+#include <stdlib.h>
+#include <string.h>
+#include <iostream>
 
 RPOSolution::RPOSolution(RPOInstance &instance) {
 	_numParametrs = instance.getNumParameters();
-	_sol.clear();
-	for (int i = 0; i < instance.getNumParameters(); i++)
-		_sol.push_back(0);
-	_fitness = instance.getFitness(*this);
+	_sol.assign(_numParametrs, 0);
+	_fitness = instance.getInitialFitness();
     _fitnessAssigned=0;
+    _evalState = NULL;
+#ifdef RPO_CHECK_FITNESS
+	_fitnessStale = false;
+#endif
 }
 
 RPOSolution::~RPOSolution() {
 	_sol.clear();
 
+	if (_evalState != NULL){
+		delete _evalState;
+		_evalState = NULL;
+	}
+}
+
+void RPOSolution::reset(RPOInstance &instance){
+	_sol.assign(_numParametrs, 0);
+	_fitness = instance.getInitialFitness();
+	_fitnessAssigned = 0;
+#ifdef RPO_CHECK_FITNESS
+	_fitnessStale = false;
+#endif
+
+	//The vectors of the state are kept, but they are recomputed in the next evaluation
+	if (_evalState != NULL)
+		_evalState->invalidate();
 }
 
 void RPOSolution::ChangeParameterTo(int parameter, int value){
-	_sol[parameter] = value;
+	_sol[parameter] = (RPOGene) value;
+#ifdef RPO_CHECK_FITNESS
+	_fitnessStale = true;
+#endif
 }
 
 int RPOSolution::parameterValue(int parameter){
@@ -34,14 +60,43 @@ int RPOSolution::parameterValue(int parameter){
 }
 
 double RPOSolution::getFitness() const{
+#ifdef RPO_CHECK_FITNESS
+	if (_fitnessStale){
+		cerr << "Error: The fitness of a solution is read after changing its parameters, without assigning it again" << endl;
+		exit(1);
+	}
+#endif
 	return _fitness;
 }
 
+RPOEvalState &RPOSolution::getEvalState(){
+	//The state of the objective of RPOInstance
+	if (_evalState == NULL)
+		_evalState = new RPOInstance::ObjectiveType::State();
+	return *_evalState;
+}
+
 void RPOSolution::copy(Solution& solution) {
 	RPOSolution &auxSol = (RPOSolution&) solution;
-	_sol.clear();
-    for (int i = 0; i < auxSol._sol.size(); i++)
-        _sol.push_back(auxSol._sol.at(i));
+	_sol.resize(auxSol._sol.size());
+	memcpy(&_sol[0], &auxSol._sol[0], _sol.size() * sizeof(RPOGene));
     _fitnessAssigned=auxSol.hasValidFitness();
     _fitness = auxSol._fitness;
-}
\ No newline at end of file
+#ifdef RPO_CHECK_FITNESS
+	_fitnessStale = auxSol._fitnessStale;
+#endif
+
+	//The state is not copied: it is recomputed in the next evaluation of a change
+	if (_evalState != NULL)
+		_evalState->invalidate();
+}
+
+void RPOSolution::swap(RPOSolution &solution){
+	_sol.swap(solution._sol);
+	std::swap(_numParametrs, solution._numParametrs);
+	std::swap(_fitness, solution._fitness);
+	std::swap(_fitnessAssigned, solution._fitnessAssigned);
+#ifdef RPO_CHECK_FITNESS
+	std::swap(_fitnessStale, solution._fitnessStale);
+#endif
+}
@@ -0,0 +1,47 @@
+/*
+ * RPOSolutionPool.cpp
+ *
+ * File defining the methods of the class RPOSolutionPool.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#include <RPOSolutionPool.h>
+#include <new>
+
+RPOSolutionPool::RPOSolutionPool(RPOInstance &instance, unsigned chunkSize){
+	_instance = &instance;
+	_chunkSize = (chunkSize > 0) ? chunkSize : 1;
+}
+
+RPOSolutionPool::~RPOSolutionPool(){
+	for (RPOSolution *chunk : _chunks){
+		for (unsigned i = 0; i < _chunkSize; i++)
+			chunk[i].~RPOSolution();
+		::operator delete(chunk);
+	}
+	_chunks.clear();
+	_free.clear();
+}
+
+void RPOSolutionPool::grow(){
+	RPOSolution *chunk = (RPOSolution*) ::operator new(sizeof(RPOSolution) * _chunkSize);
+	for (unsigned i = 0; i < _chunkSize; i++)
+		new (&chunk[i]) RPOSolution(*_instance);
+	_chunks.push_back(chunk);
+
+	//The free list can hold all the solutions, so release never allocates
+	_free.reserve(getNumSolutions());
+	for (unsigned i = _chunkSize; i > 0; i--)
+		_free.push_back(&chunk[i - 1]);
+}
+
+RPOSolution *RPOSolutionPool::acquire(){
+	if (_free.empty())
+		grow();
+	RPOSolution *solution = _free.back();
+	_free.pop_back();
+	solution->reset(*_instance);
+	return solution;
+}
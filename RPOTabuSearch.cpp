@@ -37,7 +37,7 @@ void RPOTabuSearch::setSolution(RPOSolution* solution) {
 		_bestSolution = new RPOSolution(*_instance);
 	}
 
-	_bestSolution->copy(*solution);
+	_bestTracker.track(*_bestSolution, *solution);
 }
 
 void RPOTabuSearch::run(RPOStopCondition& stopCondition) {
@@ -67,6 +67,7 @@ void RPOTabuSearch::run(RPOStopCondition& stopCondition) {
 		double bestDeltaFitness = 0;
 		bool initialisedDeltaFitness = false;
 		RPOObjectAssignmentOperation bestOperation;
+		vector<double> deltas;
 
 		//Obtain the best non-tabu operation
 		for (unsigned i = 0; i < numParam; i++) {
@@ -76,6 +77,7 @@ void RPOTabuSearch::run(RPOStopCondition& stopCondition) {
 			if (_shortTermMem_aux.find(indexParam) == _shortTermMem_aux.end()) {
 
 				//Try all the knapsacks (including 0) and choose the best option
+				RPOEvaluator::computeDeltaFitnessSweep(*_instance, *_solution, indexParam, deltas);
 				for (unsigned j = 0; j < _instance->getLengthD(indexParam); j++) {
 					int paramValue=j;
 					//Ignore the change which does not modify the object
@@ -83,7 +85,7 @@ void RPOTabuSearch::run(RPOStopCondition& stopCondition) {
 						continue;
 
 					//Obtain the difference of fitness of applying the operation
-					double deltaFitness = RPOEvaluator::computeDeltaFitness(*_instance, *_solution, indexParam, paramValue);
+					double deltaFitness = deltas[paramValue];
 
 					//If the difference of fitness is the best up to this moment,
 					//store it to apply it later
@@ -98,6 +100,7 @@ void RPOTabuSearch::run(RPOStopCondition& stopCondition) {
 		}
 
 		//Apply the operation and store it in the short term memory
+		_bestTracker.notifyChange(bestOperation.getParam());
 		bestOperation.apply(*_solution);
 		_shortTermMem.push(bestOperation.getParam());
 		_shortTermMem_aux.insert(bestOperation.getParam());
@@ -113,8 +116,8 @@ void RPOTabuSearch::run(RPOStopCondition& stopCondition) {
 
 		//Update the best solution
 		if (RPOEvaluator::compare(_solution->getFitness(),
-				_bestSolution->getFitness()) > 0) {
-			_bestSolution->copy(*_solution);
+				_bestTracker.getFitness()) > 0) {
+			_bestTracker.update();
 		}
 
 		numIterations++;
@@ -122,4 +125,8 @@ void RPOTabuSearch::run(RPOStopCondition& stopCondition) {
 
 		stopCondition.notifyIteration();
 	}
+
+	//Build the best solution in _bestSolution, as _solution belongs to the caller and can be
+	//changed after the run
+	_bestTracker.getSolution();
 }
@@ -0,0 +1,209 @@
+/**
+ * DSweepBenchmark.cpp
+ *
+ * Benchmark of the cost per iteration of the metaheuristics as the dimension grows, for finding
+ * where each one stops scaling. For every dimension it measures a full evaluation of a random
+ * solution and runs each metaheuristic, with the parameters of main.cpp, during the given time
+ * (at least one iteration), printing the time and the evaluations per iteration. A metaheuristic
+ * whose iteration takes longer than MAX_ITERATION_RUNS runs has stopped scaling, and it is not run
+ * in the larger dimensions. The dimensions without data files use the generated rotations and
+ * shifts (see FuncData).
+ *
+ * The dense rotations take O(D^2) memory, so they go up to D=1000; with a size of the groups of
+ * the rotations (see Func) the dimensions go up to 10000. It is run from the directory which
+ * contains input_data (the generated data is cached there). From the root of the repository:
+ *   g++ -std=c++17 -O2 -Iinclude benchmarks/DSweepBenchmark.cpp RPO*.cpp Timer.cpp -o DSweepBenchmark
+ *   ./DSweepBenchmark [function] [seconds per run] [size of the groups of the rotations] [largest D]
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#include <RPOInstance.h>
+#include <RPOSolution.h>
+#include <RPOEvaluator.h>
+#include <RPOSolGenerator.h>
+#include <RPOStopCondition.h>
+#include <RPOEvaluationContext.h>
+#include <RPOSimulatedAnnealing.h>
+#include <RPOTabuSearch.h>
+#include <RPOGrasp.h>
+#include <RPOIteratedGreedy.h>
+#include <RPOGeneticAlgorithm.h>
+#include <RPOAntColonyOpt.h>
+#include <Timer.h>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+
+#define SEED 2013 //Seed of the random number generator, before each run
+#define MIN_EVALUATIONS 100 //Full evaluations measured in every dimension (at least)
+#define MAX_ITERATION_RUNS 5 //A metaheuristic whose iteration takes longer than these runs is not run in larger dimensions
+
+enum { SA, TS, GRASP, IG, GA, ACO, NUM_METAHEURISTICS };
+
+/**
+ * Function which prints the cost per iteration of a run, and stops running the metaheuristic in
+ * the larger dimensions if an iteration takes longer than MAX_ITERATION_RUNS runs
+ * @param[in] metaheuristic Metaheuristic (SA, TS, ...)
+ * @param[in] t Timer started before the run
+ * @param[in] stopCondition Stop condition of the run (with its iterations and evaluations)
+ * @param[in] seconds Time of every run
+ * @param[in,out] active Metaheuristics which are run
+ */
+static void report(int metaheuristic, Timer &t, RPOStopCondition &stopCondition, double seconds, vector<bool> &active){
+	static const char *names[]={"SA", "TS", "GRASP", "IG", "GA", "ACO"};
+	double elapsed=t.elapsed_time(Timer::VIRTUAL);
+	unsigned iterations=max(1u, stopCondition.getIterarions());
+	printf(" %6s %12.3f %12.1f %10u\n", names[metaheuristic], 1e3*elapsed/iterations,
+			(double) stopCondition.getNumEvaluations()/iterations, iterations);
+	if (elapsed/iterations>MAX_ITERATION_RUNS*seconds)
+	{
+		printf(" %6s stops scaling: it is not run in the larger dimensions\n", names[metaheuristic]);
+		active[metaheuristic]=false;
+	}
+}
+
+/**
+ * Function which runs the metaheuristics over an instance, each one with its own evaluation context
+ * @param[in] instance Instance of the problem
+ * @param[in] seconds Time of every run
+ * @param[in,out] active Metaheuristics which are run (see report)
+ */
+static void runMetaheuristics(RPOInstance &instance, double seconds, vector<bool> &active){
+	if (active[SA])
+	{
+		RPOEvaluationContext context;
+		RPOEvaluationContext::Scope scope(context);
+		RPOStopCondition stopCondition;
+		RPOSolution solution(instance);
+		RPOSimulatedAnnealing sa;
+		srand(SEED);
+		sa.initialise(0.9, 10, 0.9999, 50, instance);
+		RPOSolGenerator::genRandomSol(instance, solution);
+		sa.setSolution(&solution);
+		Timer t;
+		stopCondition.setConditions(0, 0, seconds);
+		sa.run(stopCondition);
+		report(SA, t, stopCondition, seconds, active);
+	}
+	if (active[TS])
+	{
+		RPOEvaluationContext context;
+		RPOEvaluationContext::Scope scope(context);
+		RPOStopCondition stopCondition;
+		RPOSolution solution(instance);
+		RPOTabuSearch ts;
+		srand(SEED);
+		ts.initialise(&instance, ((unsigned)(instance.getNumParameters() / 2.5)));
+		RPOSolGenerator::genRandomSol(instance, solution);
+		ts.setSolution(&solution);
+		Timer t;
+		stopCondition.setConditions(0, 0, seconds);
+		ts.run(stopCondition);
+		report(TS, t, stopCondition, seconds, active);
+	}
+	if (active[GRASP])
+	{
+		RPOEvaluationContext context;
+		RPOEvaluationContext::Scope scope(context);
+		RPOStopCondition stopCondition;
+		RPOGrasp grasp;
+		srand(SEED);
+		grasp.initialise(0.25, instance);
+		Timer t;
+		stopCondition.setConditions(0, 0, seconds);
+		grasp.run(stopCondition);
+		report(GRASP, t, stopCondition, seconds, active);
+	}
+	if (active[IG])
+	{
+		RPOEvaluationContext context;
+		RPOEvaluationContext::Scope scope(context);
+		RPOStopCondition stopCondition;
+		RPOIteratedGreedy ig;
+		srand(SEED);
+		ig.initialise(0.25, instance);
+		Timer t;
+		stopCondition.setConditions(0, 0, seconds);
+		ig.run(stopCondition);
+		report(IG, t, stopCondition, seconds, active);
+	}
+	if (active[GA])
+	{
+		RPOEvaluationContext context;
+		RPOEvaluationContext::Scope scope(context);
+		RPOStopCondition stopCondition;
+		RPOGeneticAlgorithm ga;
+		srand(SEED);
+		ga.initialise(60, instance);
+		Timer t;
+		stopCondition.setConditions(0, 0, seconds);
+		ga.run(stopCondition);
+		report(GA, t, stopCondition, seconds, active);
+	}
+	if (active[ACO])
+	{
+		RPOEvaluationContext context;
+		RPOEvaluationContext::Scope scope(context);
+		RPOStopCondition stopCondition;
+		RPOAntColonyOpt aco;
+		srand(SEED);
+		aco.initialise(10, 0.7, 0.1, 0.5, 10, 0.0000001, 4000, instance);
+		Timer t;
+		stopCondition.setConditions(0, 0, seconds);
+		aco.run(stopCondition);
+		report(ACO, t, stopCondition, seconds, active);
+	}
+}
+
+int main(int argc, char **argv){
+	int numfunc=(argc>1)?atoi(argv[1]):6;
+	double seconds=(argc>2)?atof(argv[2]):1.0;
+	int rotationGroup=(argc>3)?atoi(argv[3]):0;
+	int maxDimension=(argc>4)?atoi(argv[4]):(rotationGroup>0?10000:1000);
+	vector<int> dimensions={10, 30, 50, 100, 200, 500, 1000};
+	if (rotationGroup>0)
+	{
+		dimensions.push_back(2000);
+		dimensions.push_back(5000);
+		dimensions.push_back(10000);
+	}
+
+	vector<bool> active(NUM_METAHEURISTICS, true);
+
+	printf("Function %d, %.1f s per run, %s rotations\n", numfunc, seconds, rotationGroup>0?"grouped":"dense");
+
+	for (int nx : dimensions)
+	{
+		if (nx>maxDimension)
+			break;
+		RPOInstance instance(nx, numfunc, Func::DEFAULT_DATA_SEED, rotationGroup);
+		RPOSolution solution(instance);
+		RPOEvaluationContext context;
+		RPOEvaluationContext::Scope scope(context);
+
+		//Full evaluations of random solutions, during a tenth of the time of a run
+		srand(SEED);
+		unsigned numEvaluations=0;
+		Timer t;
+		double total=0;
+		do
+		{
+			for (int e=0; e<MIN_EVALUATIONS; e++)
+			{
+				RPOSolGenerator::genRandomParameters(instance, solution);
+				total+=RPOEvaluator::computeFitness(instance, solution);
+			}
+			numEvaluations+=MIN_EVALUATIONS;
+		} while (t.elapsed_time(Timer::VIRTUAL)<seconds/10);
+		double evaluation=1e6*t.elapsed_time(Timer::VIRTUAL)/numEvaluations;
+
+		printf("\nD=%d: full evaluation %.2f us (mean fitness %g)\n", nx, evaluation, total/numEvaluations);
+		printf(" %6s %12s %12s %10s\n", "", "ms/iter.", "evals/iter.", "iterations");
+		runMetaheuristics(instance, seconds, active);
+	}
+	return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * KatsuuraBenchmark.cpp
+ *
+ * Benchmark of the sums of the Katsuura function (16): the original loop, with pow(2.0,j) for
+ * each of the 32 terms of every dimension, against the katsuura kernel of FuncKernels, which
+ * obtains the powers of two by doubling and halving and computes several dimensions at once.
+ * Both are followed by the same final product, as in Func. It also checks that the sums of the
+ * kernel are bit-identical to those of the original loop.
+ *
+ * The kernels are those of the best instruction set of the processor, or the ones given by the
+ * environment variable FUNC_KERNELS (scalar, sse2, avx2 or avx512). From the root of the repository:
+ *   g++ -std=c++17 -O2 -Iinclude benchmarks/KatsuuraBenchmark.cpp -o KatsuuraBenchmark
+ *   ./KatsuuraBenchmark [evaluations]
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#include <FuncKernels.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/* Sums of the original code of CEC 2013 */
+static void originalsums(const double *y, double *s, int nx){
+	int i,j;
+	double temp,tmp1,tmp2;
+	for (i=0; i<nx; i++)
+	{
+		temp=0.0;
+		for (j=1; j<=32; j++)
+		{
+			tmp1=pow(2.0,j);
+			tmp2=tmp1*y[i];
+			temp += fabs(tmp2-floor(tmp2+0.5))/tmp1;
+		}
+		s[i]=temp;
+	}
+}
+
+/* Final product of the Katsuura function, given the sums of every dimension */
+static double product(const double *s, int nx, double exponent){
+	double f=1.0;
+	for (int i=0; i<nx; i++)
+		f *= pow(1.0+(i+1)*s[i], exponent);
+	double tmp1=10.0/nx/nx;
+	return f*tmp1-tmp1;
+}
+
+int main(int argc, char **argv){
+	const FuncKernels &kernels=FuncKernels::get();
+	int numEvaluations=(argc>1)?atoi(argv[1]):4000;
+	mt19937_64 generator(2013);
+	//Range of the rotated values of the function (the shrunk point, scaled by up to 10)
+	uniform_real_distribution<double> distribution(-50.0, 50.0);
+	int dimensions[]={10, 30, 50, 100};
+	bool identical=true;
+
+	printf("Kernels: %s, %d evaluations\n", kernels.name, numEvaluations);
+	printf("%6s %14s %14s %9s\n", "D", "original (ms)", "kernel (ms)", "speedup");
+
+	for (int nx : dimensions)
+	{
+		vector<double> y((size_t) numEvaluations*nx), s(nx), t(nx);
+		for (double &value : y)
+			value=distribution(generator);
+		double exponent=10.0/pow(1.0*nx,1.2), totalOriginal=0, totalKernel=0;
+
+		chrono::steady_clock::time_point t0=chrono::steady_clock::now();
+		for (int e=0; e<numEvaluations; e++)
+		{
+			originalsums(&y[(size_t) e*nx], &s[0], nx);
+			totalOriginal += product(&s[0], nx, exponent);
+		}
+		chrono::steady_clock::time_point t1=chrono::steady_clock::now();
+		for (int e=0; e<numEvaluations; e++)
+		{
+			kernels.katsuura(&y[(size_t) e*nx], &t[0], nx);
+			totalKernel += product(&t[0], nx, exponent);
+		}
+		chrono::steady_clock::time_point t2=chrono::steady_clock::now();
+
+		//Comparison of the sums, outside the measured loops (the totals, added in the same order,
+		//are also the same if the products are)
+		if (totalOriginal!=totalKernel)
+			identical=false;
+		for (int e=0; e<numEvaluations; e++)
+		{
+			originalsums(&y[(size_t) e*nx], &s[0], nx);
+			kernels.katsuura(&y[(size_t) e*nx], &t[0], nx);
+			for (int i=0; i<nx; i++)
+				if (s[i]!=t[i])
+					identical=false;
+		}
+
+		double original=chrono::duration<double, milli>(t1-t0).count();
+		double kernel=chrono::duration<double, milli>(t2-t1).count();
+		printf("%6d %14.2f %14.2f %8.1fx\n", nx, original, kernel, original/kernel);
+	}
+
+	printf(identical?"The sums of the kernel are identical to the original ones\n":"ERROR: The sums of the kernel differ from the original ones\n");
+	return identical?0:1;
+}
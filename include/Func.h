@@ -21,115 +21,281 @@
 #include <iostream>
 #include <fstream>
 #include "math.h"
+#include "FuncKernels.h"
+#include "FuncData.h"
+#include "FuncState.h"
+#include "RPOObjective.h"
 
 using namespace std;
 
-class Func {
+/**
+ * Class with the scratch vectors used while evaluating a function. The evaluation does not modify
+ * the Func object, so a single object can be shared by several threads as long as every thread
+ * evaluates with its own workspace. The vectors grow the first time they are used, so later
+ * evaluations do not allocate memory.
+ */
+class FuncWorkspace {
+	friend class Func;
+
+	/**
+	 * Properties of the class
+	 * _x Point in the search space (parameters centred in 0)
+	 * _y, _z, _w Vectors where the basic functions are computed
+	 * _cf Weights of the components of the composition functions
+	 * _by, _bz Vectors y and z of a block of FUNC_BATCH solutions, one row of FUNC_BATCH values per dimension
+	 */
+	vector<double> _x, _y, _z, _w, _cf, _by, _bz;
+
+	void reserve(int nx){
+		if ((int)_x.size()<nx)
+		{
+			_x.resize(nx);
+			_y.resize(nx);
+			_z.resize(nx);
+			_w.resize(nx);
+			_by.resize(nx*FUNC_BATCH);
+			_bz.resize(nx*FUNC_BATCH);
+		}
+		if (_cf.size()<10)
+			_cf.resize(10);
+	}
+};
+
+class Func : public RPOObjective<Func> {
     private:
+	enum { SPHERE, ELLIPS, BENT_CIGAR, DISCUS, DIF_POWERS, ROSENBROCK, SCHAFFER_F7, ACKLEY, WEIERSTRASS,
+		GRIEWANK, RASTRIGIN, STEP_RASTRIGIN, SCHWEFEL, KATSUURA, BI_RASTRIGIN, GRIE_ROSEN, ESCAFFER6 };
+
+	/* Number of matrices and shifts read from the data files */
+	enum { DATA_BLOCKS=10 };
+
+	/* Number of generated matrices (the components of the largest composition function, and the next one, read by the tails) */
+	enum { GENERATED_BLOCKS=6 };
+
+	/* Basic function used by a test function (or by a component of a composition function) */
+	struct FuncComponent {
+		int kernel, r_flag;
+		double lambda_num, lambda_den, delta, bias;
+	};
+
+	/* Test function: one basic function, or cf_num components mixed by their weights (see cf_weights) */
+	struct FuncSpec {
+		int cf_num;
+		FuncComponent comp[5];
+		double bias;
+	};
+
     int _Dsize, func_num;
-	double *OShift,*M,*y,*z,*x_bound;
+	const double *OShift,*M,*MT;
+	const float *Mf,*MTf;
+	int _numBlocks, _groupSize, _numGroups;
+	vector<int> _perm, _position;
+	double *x_bound;
     vector<int> _Dmax;
-	
-	void sphere_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Sphere */{
-		int i;
-		shiftfunc(x, y, nx, Os);
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
-		f[0] = 0.0;
-		for (i=0; i<nx; i++)
+	const FuncSpec *spec;
+	const FuncKernels *kern;
+	struct FuncImpl;
+	const FuncImpl *_impl;
+	vector<double> _table;
+	int _numSums, _numValues, _sumOffset[5];
+	double _cfEpsilon;
+
+	/**
+	 * Whether the changes of a parameter are evaluated from scratch instead of from the cached
+	 * state (see fitnessDelta). Rotated Ackley (8) raises the first rotation to powers up to
+	 * 1e12 (asyfunc) before its cosines, so the last bits of the rotation, which are not the same
+	 * in the incremental update and in the full product, change its fitness by up to 1e-3. For
+	 * the same reason, it computes the powers and the cosines with the C library, as the
+	 * reference code does (see FuncKernels::getstrict): 1 ulp of difference in them changes its
+	 * fitness by up to 1e-6.
+	 */
+	bool _fullDelta;
+
+	/**
+	 * Conditioning constants, which only depend on the dimension (see buildconditioning)
+	 * _cond6[i] pow(10,6*i/(D-1)), the scale of the ellipsoidal function
+	 * _cond10[i] pow(10,i/(D-1)/2), the scale of Schaffer F7, Ackley, Weierstrass, Rastrigin and Schwefel
+	 * _cond100[i] pow(100,i/(D-1)/2), the scale of Griewank, Katsuura and Lunacek bi-Rastrigin
+	 * _sqrt1[i] sqrt(1+i), the divisors of Griewank
+	 * _difExp[i] 2+4*i/(D-1) (integer division, as in CEC 2013), the exponents of the different powers
+	 * _katsuuraExp, _biS, _biMu1 Exponent of the products of Katsuura, and s and mu1 of Lunacek bi-Rastrigin
+	 */
+	vector<double> _cond6, _cond10, _cond100, _sqrt1, _difExp;
+	double _katsuuraExp, _biS, _biMu1;
+
+	static const FuncSpec *getspec(int num){
+		static const FuncSpec specs[28] = {
+			{0, {{SPHERE, 0}}, -1400.0},
+			{0, {{ELLIPS, 1}}, -1300.0},
+			{0, {{BENT_CIGAR, 1}}, -1200.0},
+			{0, {{DISCUS, 1}}, -1100.0},
+			{0, {{DIF_POWERS, 0}}, -1000.0},
+			{0, {{ROSENBROCK, 1}}, -900.0},
+			{0, {{SCHAFFER_F7, 1}}, -800.0},
+			{0, {{ACKLEY, 1}}, -700.0},
+			{0, {{WEIERSTRASS, 1}}, -600.0},
+			{0, {{GRIEWANK, 1}}, -500.0},
+			{0, {{RASTRIGIN, 0}}, -400.0},
+			{0, {{RASTRIGIN, 1}}, -300.0},
+			{0, {{STEP_RASTRIGIN, 1}}, -200.0},
+			{0, {{SCHWEFEL, 0}}, -100.0},
+			{0, {{SCHWEFEL, 1}}, 100.0},
+			{0, {{KATSUURA, 1}}, 200.0},
+			{0, {{BI_RASTRIGIN, 0}}, 300.0},
+			{0, {{BI_RASTRIGIN, 1}}, 400.0},
+			{0, {{GRIE_ROSEN, 1}}, 500.0},
+			{0, {{ESCAFFER6, 1}}, 600.0},
+			{5, {{ROSENBROCK, 1, 10000, 1e+4, 10, 0}, {DIF_POWERS, 1, 10000, 1e+10, 20, 100},
+				{BENT_CIGAR, 1, 10000, 1e+30, 30, 200}, {DISCUS, 1, 10000, 1e+10, 40, 300},
+				{SPHERE, 0, 10000, 1e+5, 50, 400}}, 700.0}, /* Composition Function 1 */
+			{3, {{SCHWEFEL, 0, 1, 1, 20, 0}, {SCHWEFEL, 0, 1, 1, 20, 100},
+				{SCHWEFEL, 0, 1, 1, 20, 200}}, 800.0}, /* Composition Function 2 */
+			{3, {{SCHWEFEL, 1, 1, 1, 20, 0}, {SCHWEFEL, 1, 1, 1, 20, 100},
+				{SCHWEFEL, 1, 1, 1, 20, 200}}, 900.0}, /* Composition Function 3 */
+			{3, {{SCHWEFEL, 1, 1000, 4e+3, 20, 0}, {RASTRIGIN, 1, 1000, 1e+3, 20, 100},
+				{WEIERSTRASS, 1, 1000, 400, 20, 200}}, 1000.0}, /* Composition Function 4 */
+			{3, {{SCHWEFEL, 1, 1000, 4e+3, 10, 0}, {RASTRIGIN, 1, 1000, 1e+3, 30, 100},
+				{WEIERSTRASS, 1, 1000, 400, 50, 200}}, 1100.0}, /* Composition Function 5 */
+			{5, {{SCHWEFEL, 1, 1000, 4e+3, 10, 0}, {RASTRIGIN, 1, 1000, 1e+3, 10, 100},
+				{ELLIPS, 1, 1000, 1e+10, 10, 200}, {WEIERSTRASS, 1, 1000, 400, 10, 300},
+				{GRIEWANK, 1, 1000, 100, 10, 400}}, 1200.0}, /* Composition Function 6 */
+			{5, {{GRIEWANK, 1, 10000, 100, 10, 0}, {RASTRIGIN, 1, 10000, 1e+3, 10, 100},
+				{SCHWEFEL, 1, 10000, 4e+3, 10, 200}, {WEIERSTRASS, 1, 10000, 400, 20, 300},
+				{SPHERE, 0, 10000, 1e+5, 20, 400}}, 1300.0}, /* Composition Function 7 */
+			{5, {{GRIE_ROSEN, 1, 10000, 4e+3, 10, 0}, {SCHAFFER_F7, 1, 10000, 4e+6, 20, 100},
+				{SCHWEFEL, 1, 10000, 4e+3, 30, 200}, {ESCAFFER6, 1, 10000, 2e+7, 40, 300},
+				{SPHERE, 0, 10000, 1e+5, 50, 400}}, 1400.0} /* Composition Function 8 */
+		};
+		if (num<1||num>28)
+			return NULL;
+		return &specs[num-1];
+	}
+
+	/*
+	 * Shrink to the original search range of the basic function: y=((x-Os)*a)/b. The factors give
+	 * exactly the same operations as the original expressions (the bi-Rastrigin 2*y is the exact
+	 * division by 0.5, and its sign is changed afterwards, see shrinkfunc).
+	 */
+	static void shrinkscale (int kernel, double &a, double &b){
+		b=1.0;
+		switch(kernel)
 		{
-			f[0] += z[i]*z[i];
+			case ROSENBROCK:
+				a=2.048; b=100; break;
+			case WEIERSTRASS:
+				a=0.5; b=100; break;
+			case GRIEWANK:
+				a=600.0; b=100.0; break;
+			case RASTRIGIN:
+			case STEP_RASTRIGIN:
+				a=5.12; b=100; break;
+			case SCHWEFEL:
+				a=1000/100; break;
+			case KATSUURA:
+				a=5.0/100.0; break;
+			case BI_RASTRIGIN:
+				a=10.0/100.0; b=0.5; break;
+			case GRIE_ROSEN:
+				a=5; b=100; break;
+			default:
+				a=1.0;
 		}
 	}
 
-	void ellips_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Ellipsoidal */{
+	/* Shift of one coordinate and shrink to the original search range of the basic function */
+	static double shrinkfunc (double x, double Os, int kernel){
+		double a,b,y;
+		shrinkscale(kernel, a, b);
+		y=(x-Os)*a/b;
+		if (kernel==BI_RASTRIGIN && Os < 0.)
+			y *= -1.;
+		return y;
+	}
+
+	/* Shift, shrink and first rotation. Every basic function starts this way */
+	template<int ND>
+	void headfunc (double *x, double *y, double *z, int nx, const double *Os, int mr, int r_flag, int kernel) const{
 		int i;
-		shiftfunc(x, y, nx, Os);
+		if (ND>0) nx=ND;
+		double a,b;
+		shrinkscale(kernel, a, b);
+		kern->shrink(x, Os, y, nx, a, b);
+		if (kernel==BI_RASTRIGIN)
+			for (i=0; i<nx; i++)
+				if (Os[i] < 0.)
+					y[i] *= -1.;
 		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
+		rotatefunc(y, z, nx, mr);
 		else
 		for (i=0; i<nx; i++)
 			z[i]=y[i];
+	}
+
+	/*
+	 * The *_tail functions receive in y the output of shrinkfunc and in z its first rotation, and
+	 * compute the rest of the basic function. They can overwrite y, z and w.
+	 * ND is the dimension, if it is known at compile time (0 otherwise, and then nx is used), so
+	 * that the loops have a constant length and the compiler can unroll and vectorize them.
+	 */
+
+	template<int ND>
+	void sphere_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Sphere */{
+		if (ND>0) nx=ND;
+		f[0] = kern->sumsq(z, nx);
+	}
+
+	template<int ND>
+	void ellips_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Ellipsoidal */{
+		if (ND>0) nx=ND;
+		int i;
 		oszfunc (z, y, nx);
 		f[0] = 0.0;
 		for (i=0; i<nx; i++)
 		{
-			f[0] += pow(10.0,6.0*i/(nx-1))*y[i]*y[i];
+			f[0] += _cond6[i]*y[i]*y[i];
 		}
 	}
 
-	void bent_cigar_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Bent_Cigar */{
+	template<int ND>
+	void bent_cigar_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Bent_Cigar */{
+		if (ND>0) nx=ND;
 		int i;
 		double beta=0.5;
-		shiftfunc(x, y, nx, Os);
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
 		asyfunc (z, y, nx,beta);
 		if (r_flag==1)
-		rotatefunc(y, z, nx, &Mr[nx*nx]);
+		rotatefunc(y, z, nx, mr+1);
 		else
 		for (i=0; i<nx; i++)
 			z[i]=y[i];
 
-		f[0] = z[0]*z[0];
-		for (i=1; i<nx; i++)
-		{
-			f[0] += pow(10.0,6.0)*z[i]*z[i];
-		}
+		f[0] = z[0]*z[0] + pow(10.0,6.0)*kern->sumsq(&z[1], nx-1);
 	}
 
-	void discus_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Discus */{
-		int i;
-		shiftfunc(x, y, nx, Os);
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
+	template<int ND>
+	void discus_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Discus */{
+		if (ND>0) nx=ND;
 		oszfunc (z, y, nx);
 
-		f[0] = pow(10.0,6.0)*y[0]*y[0];
-		for (i=1; i<nx; i++)
-		{
-			f[0] += y[i]*y[i];
-		}
+		f[0] = pow(10.0,6.0)*y[0]*y[0] + kern->sumsq(&y[1], nx-1);
 	}
 
-	void dif_powers_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Different Powers */{
+	template<int ND>
+	void dif_powers_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Different Powers */{
+		if (ND>0) nx=ND;
 		int i;
-		shiftfunc(x, y, nx, Os);
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
 		f[0] = 0.0;
 		for (i=0; i<nx; i++)
 		{
-			f[0] += pow(fabs(z[i]),2+4*i/(nx-1));
+			f[0] += pow(fabs(z[i]),_difExp[i]);
 		}
 		f[0]=pow(f[0],0.5);
 	}
 
-	void rosenbrock_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Rosenbrock's */{
+	template<int ND>
+	void rosenbrock_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Rosenbrock's */{
+		if (ND>0) nx=ND;
 		int i;
 		double tmp1,tmp2;
-		shiftfunc(x, y, nx, Os);//shift
-		for (i=0; i<nx; i++)//shrink to the orginal search range
-		{
-			y[i]=y[i]*2.048/100;
-		}
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);//rotate
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
 		for (i=0; i<nx; i++)//shift to orgin
 		{
 			z[i]=z[i]+1;
@@ -144,194 +310,186 @@ class Func {
 		}
 	}
 
-	void schaffer_F7_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Schwefel's 1.2  */{
+	template<int ND>
+	void schaffer_F7_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Schwefel's 1.2  */{
+		if (ND>0) nx=ND;
 		int i;
 		double tmp;
-		shiftfunc(x, y, nx, Os);
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
 		asyfunc (z, y, nx, 0.5);
 		for (i=0; i<nx; i++)
-			z[i] = y[i]*pow(10.0,1.0*i/(nx-1)/2.0);
+			z[i] = y[i]*_cond10[i];
 		if (r_flag==1)
-		rotatefunc(z, y, nx, &Mr[nx*nx]);
+		rotatefunc(z, y, nx, mr+1);
 		else
 		for (i=0; i<nx; i++)
 			y[i]=z[i];
 
 		for (i=0; i<nx-1; i++)
-			z[i]=pow(y[i]*y[i]+y[i+1]*y[i+1],0.5);
+			w[i]=y[i]*y[i]+y[i+1]*y[i+1];
+		kern->powconst(w, z, nx-1, 0.5);
+		//w=sin(50*z^0.2), y=z^0.5
+		kern->powconst(z, w, nx-1, 0.2);
+		for (i=0; i<nx-1; i++)
+			w[i]=50.0*w[i];
+		kern->sine(w, w, nx-1);
+		kern->powconst(z, y, nx-1, 0.5);
 		f[0] = 0.0;
 		for (i=0; i<nx-1; i++)
 		{
-		  tmp=sin(50.0*pow(z[i],0.2));
-		  f[0] += pow(z[i],0.5)+pow(z[i],0.5)*tmp*tmp ;
+		  tmp=w[i];
+		  f[0] += y[i]+y[i]*tmp*tmp ;
 		}
 		f[0] = f[0]*f[0]/(nx-1)/(nx-1);
 	}
 
-	void ackley_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Ackley's  */{
+	template<int ND>
+	void ackley_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Ackley's  */{
+		if (ND>0) nx=ND;
 		int i;
 		double sum1, sum2;
 
-		shiftfunc(x, y, nx, Os);
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
-
 		asyfunc (z, y, nx, 0.5);
 		for (i=0; i<nx; i++)
-			z[i] = y[i]*pow(10.0,1.0*i/(nx-1)/2.0);
+			z[i] = y[i]*_cond10[i];
 		if (r_flag==1)
-		rotatefunc(z, y, nx, &Mr[nx*nx]);
+		rotatefunc(z, y, nx, mr+1);
 		else
 		for (i=0; i<nx; i++)
 			y[i]=z[i];
 
-		sum1 = 0.0;
+		sum1 = kern->sumsq(y, nx);
 		sum2 = 0.0;
+		for (i=0; i<nx; i++)
+			w[i]=2.0*PI*y[i];
+		kern->cosine(w, w, nx);
 		for (i=0; i<nx; i++)
 		{
-			sum1 += y[i]*y[i];
-			sum2 += cos(2.0*PI*y[i]);
+			sum2 += w[i];
 		}
 		sum1 = -0.2*sqrt(sum1/nx);
 		sum2 /= nx;
 		f[0] =  E - 20.0*exp(sum1) - exp(sum2) +20.0;
 	}
 
-	void weierstrass_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Weierstrass's  */{
-		int i,j,k_max;
-		double sum,sum2, a, b;
+	/* Constants of the Weierstrass function (a=0.5, b=3, k_max=20), computed once: a^j, 2*PI*b^j and
+	 * sum2, the sum of a^j*cos(2*PI*b^j*0.5). The terms after k_max are padding for the cosine kernel */
+	enum { WEIERSTRASS_KMAX=20, WEIERSTRASS_TERMS=24 };
+	struct WeierstrassTable {
+		double a[WEIERSTRASS_TERMS], c[WEIERSTRASS_TERMS], sum2;
+	};
+
+	static const WeierstrassTable &weierstrasstable(){
+		static const WeierstrassTable tab=buildweierstrass();
+		return tab;
+	}
 
-		shiftfunc(x, y, nx, Os);
-		for (i=0; i<nx; i++)//shrink to the orginal search range
+	static WeierstrassTable buildweierstrass(){
+		WeierstrassTable tab;
+		double a=0.5, b=3.0;
+		tab.sum2=0.0;
+		for (int j=0; j<WEIERSTRASS_TERMS; j++)
 		{
-			y[i]=y[i]*0.5/100;
+			tab.a[j]=(j<=WEIERSTRASS_KMAX) ? pow(a,j) : 0.0;
+			tab.c[j]=(j<=WEIERSTRASS_KMAX) ? 2.0*PI*pow(b,j) : 0.0;
+			if (j<=WEIERSTRASS_KMAX)
+				tab.sum2 += pow(a,j)*cos(2.0*PI*pow(b,j)*0.5);
 		}
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
+		return tab;
+	}
+
+	template<int ND>
+	void weierstrass_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Weierstrass's  */{
+		if (ND>0) nx=ND;
+		int i,j;
+		double sum;
 
 		asyfunc (z, y, nx, 0.5);
 		for (i=0; i<nx; i++)
-			z[i] = y[i]*pow(10.0,1.0*i/(nx-1)/2.0);
+			z[i] = y[i]*_cond10[i];
 		if (r_flag==1)
-		rotatefunc(z, y, nx, &Mr[nx*nx]);
+		rotatefunc(z, y, nx, mr+1);
 		else
 		for (i=0; i<nx; i++)
 			y[i]=z[i];
 
-		a = 0.5;
-		b = 3.0;
-		k_max = 20;
+		const WeierstrassTable &tab=weierstrasstable();
+		double arg[WEIERSTRASS_TERMS], c[WEIERSTRASS_TERMS];
 		f[0] = 0.0;
 		for (i=0; i<nx; i++)
 		{
+			for (j=0; j<WEIERSTRASS_TERMS; j++)
+				arg[j] = tab.c[j]*(y[i]+0.5);
+			kern->cosine(arg, c, WEIERSTRASS_TERMS);
 			sum = 0.0;
-			sum2 = 0.0;
-			for (j=0; j<=k_max; j++)
-			{
-				sum += pow(a,j)*cos(2.0*PI*pow(b,j)*(y[i]+0.5));
-				sum2 += pow(a,j)*cos(2.0*PI*pow(b,j)*0.5);
-			}
+			for (j=0; j<=WEIERSTRASS_KMAX; j++)
+				sum += tab.a[j]*c[j];
 			f[0] += sum;
 		}
-		f[0] -= nx*sum2;
+		f[0] -= nx*tab.sum2;
 	}
 
-	void griewank_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Griewank's  */{
+	template<int ND>
+	void griewank_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Griewank's  */{
+		if (ND>0) nx=ND;
 		int i;
 		double s, p;
 
-		shiftfunc(x, y, nx, Os);
-		for (i=0; i<nx; i++)//shrink to the orginal search range
-		{
-			y[i]=y[i]*600.0/100.0;
-		}
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
 		for (i=0; i<nx; i++)
-			z[i]=y[i];
-
-		for (i=0; i<nx; i++)
-			z[i] = z[i]*pow(100.0,1.0*i/(nx-1)/2.0);
+			z[i] = z[i]*_cond100[i];
 
 
-		s = 0.0;
+		s = kern->sumsq(z, nx);
 		p = 1.0;
+		for (i=0; i<nx; i++)
+			w[i]=z[i]/_sqrt1[i];
+		kern->cosine(w, w, nx);
 		for (i=0; i<nx; i++)
 		{
-			s += z[i]*z[i];
-			p *= cos(z[i]/sqrt(1.0+i));
+			p *= w[i];
 		}
 		f[0] = 1.0 + s/4000.0 - p;
 	}
 
-	void rastrigin_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Rastrigin's  */{
+	template<int ND>
+	void rastrigin_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Rastrigin's  */{
+		if (ND>0) nx=ND;
 		int i;
-		double alpha=10.0,beta=0.2;
-		shiftfunc(x, y, nx, Os);
-		for (i=0; i<nx; i++)//shrink to the orginal search range
-		{
-			y[i]=y[i]*5.12/100;
-		}
-
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
+		double beta=0.2;
 
 		oszfunc (z, y, nx);
 		asyfunc (y, z, nx, beta);
 
 		if (r_flag==1)
-		rotatefunc(z, y, nx, &Mr[nx*nx]);
+		rotatefunc(z, y, nx, mr+1);
 		else
 		for (i=0; i<nx; i++)
 			y[i]=z[i];
 
 		for (i=0; i<nx; i++)
 		{
-			y[i]*=pow(alpha,1.0*i/(nx-1)/2);
+			y[i]*=_cond10[i];
 		}
 
 		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
+		rotatefunc(y, z, nx, mr);
 		else
 		for (i=0; i<nx; i++)
 			z[i]=y[i];
 
+		for (i=0; i<nx; i++)
+			w[i]=2.0*PI*z[i];
+		kern->cosine(w, w, nx);
 		f[0] = 0.0;
 		for (i=0; i<nx; i++)
 		{
-			f[0] += (z[i]*z[i] - 10.0*cos(2.0*PI*z[i]) + 10.0);
+			f[0] += (z[i]*z[i] - 10.0*w[i] + 10.0);
 		}
 	}
 
-	void step_rastrigin_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Noncontinuous Rastrigin's  */{
+	template<int ND>
+	void step_rastrigin_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Noncontinuous Rastrigin's  */{
+		if (ND>0) nx=ND;
 		int i;
-		double alpha=10.0,beta=0.2;
-		shiftfunc(x, y, nx, Os);
-		for (i=0; i<nx; i++)//shrink to the orginal search range
-		{
-			y[i]=y[i]*5.12/100;
-		}
-
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
 
 		for (i=0; i<nx; i++)
 		{
@@ -339,154 +497,97 @@ class Func {
 			z[i]=floor(2*z[i]+0.5)/2;
 		}
 
-		oszfunc (z, y, nx);
-		asyfunc (y, z, nx, beta);
+		rastrigin_tail<ND>(y, z, w, f, nx, mr, r_flag);
+	}
 
-		if (r_flag==1)
-		rotatefunc(z, y, nx, &Mr[nx*nx]);
-		else
-		for (i=0; i<nx; i++)
-			y[i]=z[i];
+	template<int ND>
+	void schwefel_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Schwefel's  */{
+		if (ND>0) nx=ND;
+		int i;
+		double tmp;
 
 		for (i=0; i<nx; i++)
-		{
-			y[i]*=pow(alpha,1.0*i/(nx-1)/2);
-		}
+			y[i] = z[i]*_cond10[i];
 
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
 		for (i=0; i<nx; i++)
-			z[i]=y[i];
+			z[i] = y[i]+4.209687462275036e+002;
 
-		f[0] = 0.0;
+		//y=base of the power of each dimension, w=sin(y^0.5)
 		for (i=0; i<nx; i++)
 		{
-			f[0] += (z[i]*z[i] - 10.0*cos(2.0*PI*z[i]) + 10.0);
-		}
-	}
-
-	void schwefel_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Schwefel's  */{
-		int i;
-		double tmp;
-		shiftfunc(x, y, nx, Os);
-		for (i=0; i<nx; i++)//shrink to the orginal search range
-		{
-			y[i]*=1000/100;
+			if (z[i]>500)
+				y[i]=500.0-fmod(z[i],500);
+			else if (z[i]<-500)
+				y[i]=500.0-fmod(fabs(z[i]),500);
+			else
+				y[i]=fabs(z[i]);
 		}
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
+		kern->powconst(y, w, nx, 0.5);
+		kern->sine(w, w, nx);
 
-		for (i=0; i<nx; i++)
-			y[i] = z[i]*pow(10.0,1.0*i/(nx-1)/2.0);
-
-		for (i=0; i<nx; i++)
-			z[i] = y[i]+4.209687462275036e+002;
-		
 		f[0]=0;
 		for (i=0; i<nx; i++)
 		{
 			if (z[i]>500)
 			{
-				f[0]-=(500.0-fmod(z[i],500))*sin(pow(500.0-fmod(z[i],500),0.5));
+				f[0]-=y[i]*w[i];
 				tmp=(z[i]-500.0)/100;
 				f[0]+= tmp*tmp/nx;
 			}
 			else if (z[i]<-500)
 			{
-				f[0]-=(-500.0+fmod(fabs(z[i]),500))*sin(pow(500.0-fmod(fabs(z[i]),500),0.5));
+				f[0]-=(-500.0+fmod(fabs(z[i]),500))*w[i];
 				tmp=(z[i]+500.0)/100;
 				f[0]+= tmp*tmp/nx;
 			}
 			else
-				f[0]-=z[i]*sin(pow(fabs(z[i]),0.5));
+				f[0]-=z[i]*w[i];
 		}
 		f[0]=4.189828872724338e+002*nx+f[0];
 	}
 
-	void katsuura_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Katsuura  */{
-		int i,j;
-		double temp,tmp1,tmp2,tmp3;
-		tmp3=pow(1.0*nx,1.2);
-		shiftfunc(x, y, nx, Os);
-		for (i=0; i<nx; i++)//shrink to the orginal search range
-		{
-			y[i]*=5.0/100.0;
-		}
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
+	template<int ND>
+	void katsuura_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Katsuura  */{
+		if (ND>0) nx=ND;
+		int i;
+		double tmp1;
 
 		for (i=0; i<nx; i++)
-			z[i] *=pow(100.0,1.0*i/(nx-1)/2.0);
+			z[i] *=_cond100[i];
 
 		if (r_flag==1)
-		rotatefunc(z, y, nx, &Mr[nx*nx]);
+		rotatefunc(z, y, nx, mr+1);
 		else
 		for (i=0; i<nx; i++)
 			y[i]=z[i];
 
+		//Sums of the 32 terms of every dimension, which are computed together
+		kern->katsuura(y, w, nx);
 		f[0]=1.0;
 		for (i=0; i<nx; i++)
-		{
-			temp=0.0;
-			for (j=1; j<=32; j++)
-			{
-				tmp1=pow(2.0,j);
-				tmp2=tmp1*y[i];
-				temp += fabs(tmp2-floor(tmp2+0.5))/tmp1;
-			}
-			f[0] *= pow(1.0+(i+1)*temp,10.0/tmp3);
-		}
+			f[0] *= pow(1.0+(i+1)*w[i],_katsuuraExp);
 		tmp1=10.0/nx/nx;
 		f[0]=f[0]*tmp1-tmp1;
 
 	}
 
-	void bi_rastrigin_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Lunacek Bi_rastrigin Function */{
+	template<int ND>
+	void bi_rastrigin_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Lunacek Bi_rastrigin Function */{
+		if (ND>0) nx=ND;
 		int i;
-		double mu0=2.5,d=1.0,s,mu1,tmp,tmp1,tmp2;
-		double *tmpx;
-		tmpx=(double *)malloc(sizeof(double)  *  nx);
-		s=1.0-1.0/(2.0*pow(nx+20.0,0.5)-8.2);
-		mu1=-pow((mu0*mu0-d)/s,0.5);
-
-		shiftfunc(x, y, nx, Os);
-		for (i=0; i<nx; i++)//shrink to the orginal search range
-		{
-			y[i]*=10.0/100.0;
-		}
-
-		for (i = 0; i < nx; i++)
-		{
-			tmpx[i]=2*y[i];
-			if (Os[i] < 0.)
-				tmpx[i] *= -1.;
-		}
+		double mu0=2.5,d=1.0,s=_biS,mu1=_biMu1,tmp,tmp1,tmp2;
+		double *tmpx=y;
 
 		for (i=0; i<nx; i++)
-		{
-			z[i]=tmpx[i];
 			tmpx[i] += mu0;
-		}
-		if (r_flag==1)
-		rotatefunc(z, y, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			y[i]=z[i];
 
 		for (i=0; i<nx; i++)
-			y[i] *=pow(100.0,1.0*i/(nx-1)/2.0);
+			z[i] *=_cond100[i];
 		if (r_flag==1)
-		rotatefunc(y, z, nx, &Mr[nx*nx]);
+		rotatefunc(z, w, nx, mr+1);
 		else
 		for (i=0; i<nx; i++)
-			z[i]=y[i];
+			w[i]=z[i];
 
 		tmp1=0.0;tmp2=0.0;
 		for (i=0; i<nx; i++)
@@ -499,528 +600,1148 @@ class Func {
 		tmp2 *= s;
 		tmp2 += d*nx;
 		tmp=0;
+		for (i=0; i<nx; i++)
+			w[i]=2.0*PI*w[i];
+		kern->cosine(w, w, nx);
 		for (i=0; i<nx; i++)
 		{
-			tmp+=cos(2.0*PI*z[i]);
+			tmp+=w[i];
 		}
-		
+
 		if(tmp1<tmp2)
 			f[0] = tmp1;
 		else
 			f[0] = tmp2;
 		f[0] += 10.0*(nx-tmp);
-		free(tmpx);
 	}
 
-	void grie_rosen_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Griewank-Rosenbrock  */{
+	template<int ND>
+	void grie_rosen_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Griewank-Rosenbrock  */{
+		if (ND>0) nx=ND;
 		int i;
 		double temp,tmp1,tmp2;
 
-		shiftfunc(x, y, nx, Os);
-		for (i=0; i<nx; i++)//shrink to the orginal search range
-		{
-			y[i]=y[i]*5/100;
-		}
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
-
 		for (i=0; i<nx; i++)//shift to orgin
 		{
 			z[i]=y[i]+1;
 		}
 
-		f[0]=0.0;
+		//w=Rosenbrock's terms (the last one wraps around), y=cosines of the terms
 		for (i=0; i<nx-1; i++)
 		{
 			tmp1 = z[i]*z[i]-z[i+1];
 			tmp2 = z[i]-1.0;
-			temp = 100.0*tmp1*tmp1 + tmp2*tmp2;
-			 f[0] += (temp*temp)/4000.0 - cos(temp) + 1.0;
+			w[i] = 100.0*tmp1*tmp1 + tmp2*tmp2;
 		}
 		tmp1 = z[nx-1]*z[nx-1]-z[0];
 		tmp2 = z[nx-1]-1.0;
-		temp = 100.0*tmp1*tmp1 + tmp2*tmp2;;
-		 f[0] += (temp*temp)/4000.0 - cos(temp) + 1.0 ;
+		w[nx-1] = 100.0*tmp1*tmp1 + tmp2*tmp2;
+		kern->cosine(w, y, nx);
+
+		f[0]=0.0;
+		for (i=0; i<nx; i++)
+		{
+			temp = w[i];
+			 f[0] += (temp*temp)/4000.0 - y[i] + 1.0;
+		}
 	}
 
-	void escaffer6_func (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Expanded Scaffer��s F6  */{
+	template<int ND>
+	void escaffer6_tail (double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const /* Expanded Scaffer��s F6  */{
+		if (ND>0) nx=ND;
 		int i;
 		double temp1, temp2;
-		shiftfunc(x, y, nx, Os);
-		if (r_flag==1)
-		rotatefunc(y, z, nx, Mr);
-		else
-		for (i=0; i<nx; i++)
-			z[i]=y[i];
 
 		asyfunc (z, y, nx, 0.5);
 		if (r_flag==1)
-		rotatefunc(y, z, nx, &Mr[nx*nx]);
+		rotatefunc(y, z, nx, mr+1);
 		else
 		for (i=0; i<nx; i++)
 			z[i]=y[i];
 
-		f[0] = 0.0;
+		//w=squared norms of the pairs (the last one wraps around), y=sines of the norms
 		for (i=0; i<nx-1; i++)
+			w[i]=z[i]*z[i]+z[i+1]*z[i+1];
+		w[nx-1]=z[nx-1]*z[nx-1]+z[0]*z[0];
+		for (i=0; i<nx; i++)
+			y[i]=sqrt(w[i]);
+		kern->sine(y, y, nx);
+
+		f[0] = 0.0;
+		for (i=0; i<nx; i++)
 		{
-			temp1 = sin(sqrt(z[i]*z[i]+z[i+1]*z[i+1]));
-			temp1 =temp1*temp1;
-			temp2 = 1.0 + 0.001*(z[i]*z[i]+z[i+1]*z[i+1]);
+			temp1 =y[i]*y[i];
+			temp2 = 1.0 + 0.001*w[i];
 			f[0] += 0.5 + (temp1-0.5)/(temp2*temp2);
 		}
-		temp1 = sin(sqrt(z[nx-1]*z[nx-1]+z[0]*z[0]));
-		temp1 =temp1*temp1;
-		temp2 = 1.0 + 0.001*(z[nx-1]*z[nx-1]+z[0]*z[0]);
-		f[0] += 0.5 + (temp1-0.5)/(temp2*temp2);
-	}
-
-	void cf01 (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Composition Function 1 */{
-		int i,cf_num=5;
-		double fit[5];
-		double delta[5] = {10, 20, 30, 40, 50};
-		double bias[5] = {0, 100, 200, 300, 400};
-		
-		i=0;
-		rosenbrock_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/1e+4;
-		i=1;
-		dif_powers_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/1e+10;
-		i=2;
-		bent_cigar_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/1e+30;
-		i=3;
-		discus_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/1e+10;
-		i=4;
-		sphere_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],0);
-		fit[i]=10000*fit[i]/1e+5;
-		cf_cal(x, f, nx, Os, delta,bias,fit,cf_num);
-	}
-
-	void cf02 (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Composition Function 2 */{
-		int i,cf_num=3;
-		double fit[3];
-		double delta[3] = {20,20,20};
-		double bias[3] = {0, 100, 200};
-		for(i=0;i<cf_num;i++)
+	}
+
+	template<int ND>
+	void tailfunc (int kernel, double *y, double *z, double *w, double *f, int nx, int mr, int r_flag) const{
+		switch(kernel)
 		{
-			schwefel_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
+			case SPHERE: sphere_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case ELLIPS: ellips_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case BENT_CIGAR: bent_cigar_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case DISCUS: discus_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case DIF_POWERS: dif_powers_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case ROSENBROCK: rosenbrock_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case SCHAFFER_F7: schaffer_F7_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case ACKLEY: ackley_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case WEIERSTRASS: weierstrass_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case GRIEWANK: griewank_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case RASTRIGIN: rastrigin_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case STEP_RASTRIGIN: step_rastrigin_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case SCHWEFEL: schwefel_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case KATSUURA: katsuura_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case BI_RASTRIGIN: bi_rastrigin_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case GRIE_ROSEN: grie_rosen_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
+			case ESCAFFER6: escaffer6_tail<ND>(y, z, w, f, nx, mr, r_flag); break;
 		}
-		cf_cal(x, f, nx, Os, delta,bias,fit,cf_num);
 	}
 
-	void cf03 (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Composition Function 3 */{
-		int i,cf_num=3;
-		double fit[3];
-		double delta[3] = {20,20,20};
-		double bias[3] = {0, 100, 200};
-		for(i=0;i<cf_num;i++)
+	void shiftfunc (double *x, double *xshift, int nx,const double *Os) const{
+		kern->shrink(x, Os, xshift, nx, 1.0, 1.0);
+	}
+
+	/* Offset of the block of the group g of the matrix mr (the whole matrix if the rotations are dense) */
+	size_t blockoffset (int mr, int g, int nx) const{
+		if (_groupSize==0)
+			return (size_t) mr*nx*nx;
+		return ((size_t) mr*_numGroups+g)*_groupSize*_groupSize;
+	}
+
+	/* Rotation by the matrix mr. The kernel reads the same block of the transposed copy MT (or of its copy in single precision) */
+	void rotatefunc (double *x, double *xrot, int nx, int mr) const{
+		if (_groupSize>0)
+			rotategroups(x, xrot, nx, mr);
+		else if (MTf!=NULL)
+			kern->rotatef(x, xrot, nx, &MTf[blockoffset(mr, 0, nx)]);
+		else
+			kern->rotate(x, xrot, nx, &MT[blockoffset(mr, 0, nx)]);
+	}
+
+	/* Grouped rotation: the group g takes the variables _perm[g*k..g*k+k-1] and gives xrot[g*k..g*k+k-1] */
+	void rotategroups (const double *x, double *xrot, int nx, int mr) const{
+		int g,i,k=_groupSize,size;
+		const int *perm=&_perm[(size_t) mr*nx];
+		double xg[MAX_GROUP_SIZE], xrotg[MAX_GROUP_SIZE];
+		for (g=0; g<_numGroups; g++)
 		{
-			schwefel_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
+			size=(nx-g*k<k)?nx-g*k:k;
+			for (i=0; i<size; i++)
+				xg[i]=x[perm[g*k+i]];
+			for (; i<k; i++)
+				xg[i]=0.0;
+			if (MTf!=NULL)
+				kern->rotatef(xg, xrotg, k, &MTf[blockoffset(mr, g, nx)]);
+			else
+				kern->rotate(xg, xrotg, k, &MT[blockoffset(mr, g, nx)]);
+			for (i=0; i<size; i++)
+				xrot[g*k+i]=xrotg[i];
 		}
-		cf_cal(x, f, nx, Os, delta,bias,fit,cf_num);
-	}
-
-	void cf04 (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Composition Function 4 */{
-		int i,cf_num=3;
-		double fit[3];
-		double delta[3] = {20,20,20};
-		double bias[3] = {0, 100, 200};
-		i=0;
-		schwefel_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=1000*fit[i]/4e+3;
-		i=1;
-		rastrigin_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=1000*fit[i]/1e+3;
-		i=2;
-		weierstrass_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=1000*fit[i]/400;
-		cf_cal(x, f, nx, Os, delta,bias,fit,cf_num);
-	}
-
-	void cf05 (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Composition Function 4 */{
-		int i,cf_num=3;
-		double fit[3];
-		double delta[3] = {10,30,50};
-		double bias[3] = {0, 100, 200};
-		i=0;
-		schwefel_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=1000*fit[i]/4e+3;
-		i=1;
-		rastrigin_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=1000*fit[i]/1e+3;
-		i=2;
-		weierstrass_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=1000*fit[i]/400;
-		cf_cal(x, f, nx, Os, delta,bias,fit,cf_num);
-	}
-
-	void cf06 (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Composition Function 6 */{
-		int i,cf_num=5;
-		double fit[5];
-		double delta[5] = {10,10,10,10,10};
-		double bias[5] = {0, 100, 200, 300, 400};
-		i=0;
-		schwefel_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=1000*fit[i]/4e+3;
-		i=1;
-		rastrigin_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=1000*fit[i]/1e+3;
-		i=2;
-		ellips_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=1000*fit[i]/1e+10;
-		i=3;
-		weierstrass_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=1000*fit[i]/400;
-		i=4;
-		griewank_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=1000*fit[i]/100;
-		cf_cal(x, f, nx, Os, delta,bias,fit,cf_num);
-
-	}
-
-	void cf07 (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Composition Function 7 */{
-		int i,cf_num=5;
-		double fit[5];
-		double delta[5] = {10,10,10,20,20};
-		double bias[5] = {0, 100, 200, 300, 400};
-		i=0;
-		griewank_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/100;
-		i=1;
-		rastrigin_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/1e+3;
-		i=2;
-		schwefel_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/4e+3;
-		i=3;
-		weierstrass_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/400;
-		i=4;
-		sphere_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],0);
-		fit[i]=10000*fit[i]/1e+5;
-		cf_cal(x, f, nx, Os, delta,bias,fit,cf_num);
-	}
-
-	void cf08 (double *x, double *f, int nx, double *Os,double *Mr,int r_flag) /* Composition Function 8 */{
-		int i,cf_num=5;
-		double fit[5];
-		double delta[5] = {10,20,30,40,50};
-		double bias[5] = {0, 100, 200, 300, 400};
-		i=0;
-		grie_rosen_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/4e+3;
-		i=1;
-		schaffer_F7_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/4e+6;
-		i=2;
-		schwefel_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/4e+3;
-		i=3;
-		escaffer6_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],r_flag);
-		fit[i]=10000*fit[i]/2e+7;
-		i=4;
-		sphere_func(x,&fit[i],nx,&Os[i*nx],&Mr[i*nx*nx],0);
-		fit[i]=10000*fit[i]/1e+5;
-		cf_cal(x, f, nx, Os, delta,bias,fit,cf_num);
-	}
-
-	void shiftfunc (double *x, double *xshift, int nx,double *Os){
+	}
+
+	/* Rotation of a block of FUNC_BATCH vectors (see FuncKernels::rotateblock) */
+	void rotateblockfunc (const double *xb, double *xrotb, int nx, int mr) const{
+		if (_groupSize>0)
+		{
+			int g,i,s,k=_groupSize,size;
+			const int *perm=&_perm[(size_t) mr*nx];
+			double xg[MAX_GROUP_SIZE*FUNC_BATCH], xrotg[MAX_GROUP_SIZE*FUNC_BATCH];
+			for (g=0; g<_numGroups; g++)
+			{
+				size=(nx-g*k<k)?nx-g*k:k;
+				for (i=0; i<k; i++)
+					for (s=0; s<FUNC_BATCH; s++)
+						xg[i*FUNC_BATCH+s]=(i<size)?xb[perm[g*k+i]*FUNC_BATCH+s]:0.0;
+				if (Mf!=NULL)
+					kern->rotateblockf(xg, xrotg, k, &Mf[blockoffset(mr, g, nx)]);
+				else
+					kern->rotateblock(xg, xrotg, k, &M[blockoffset(mr, g, nx)]);
+				for (i=0; i<size*FUNC_BATCH; i++)
+					xrotb[g*k*FUNC_BATCH+i]=xrotg[i];
+			}
+		}
+		else if (Mf!=NULL)
+			kern->rotateblockf(xb, xrotb, nx, &Mf[blockoffset(mr, 0, nx)]);
+		else
+			kern->rotateblock(xb, xrotb, nx, &M[blockoffset(mr, 0, nx)]);
+	}
+
+	/* z+=a*(column index of the matrix of the component c): update of a rotation when the coordinate index changes by a */
+	void axpycolumn (double *z, double a, int c, int index, int nx) const{
+		if (_groupSize>0)
+		{
+			//Only the group of the variable changes: the column of its block, in the rows of the group
+			int k=_groupSize, p=_position[(size_t) c*nx+index], g=p/k, size=(nx-g*k<k)?nx-g*k:k;
+			size_t offset=blockoffset(c, g, nx)+(size_t) (p-g*k)*k;
+			if (MTf!=NULL)
+				kern->axpyf(&z[g*k], a, &MTf[offset], size);
+			else
+				kern->axpy(&z[g*k], a, &MT[offset], size);
+			return;
+		}
+		size_t offset=blockoffset(c, 0, nx)+(size_t) index*nx;
+		if (MTf!=NULL)
+			kern->axpyf(z, a, &MTf[offset], nx);
+		else
+			kern->axpy(z, a, &MT[offset], nx);
+	}
+
+	void asyfunc (double *x, double *xasy, int nx, double beta) const{
+		kern->asy(x, xasy, nx, beta);
+	}
+
+	/* Asymmetric transformation of x[i]; xasy is the value kept when x[i] is not positive */
+	static double asyelem (double x, double xasy, int i, int nx, double beta){
+		if (x>0)
+			return pow(x,1.0+beta*i/(nx-1)*pow(x,0.5));
+		return xasy;
+	}
+
+	void oszfunc (double *x, double *xosz, int nx) const{
 		int i;
 		for (i=0; i<nx; i++)
+			xosz[i]=oszelem(x[i], i, nx);
+	}
+
+	/* Oscillation transformation of x[i], applied only to the first and the last dimensions */
+	static double oszelem (double x, int i, int nx){
+		int sx;
+		double c1,c2,xx=0;
+		if (i==0||i==nx-1)
 		{
-			xshift[i]=x[i]-Os[i];
+			if (x!=0)
+				xx=log(fabs(x));
+			if (x>0)
+			{
+				c1=10;
+				c2=7.9;
+			}
+			else
+			{
+				c1=5.5;
+				c2=3.1;
+			}
+			if (x>0)
+				sx=1;
+			else if (x==0)
+				sx=0;
+			else
+				sx=-1;
+			return sx*exp(xx+0.049*(sin(c1*xx)+sin(c2*xx)));
 		}
+		return x;
 	}
 
-	void rotatefunc (double *x, double *xrot, int nx,double *Mr){
-		int i,j;
-		for (i=0; i<nx; i++)
+	/*
+	 * Composition functions. The weights of the components only depend on the distances to their
+	 * optima, so they are computed first (cf_weights), and the components whose normalised weight
+	 * is not above _cfEpsilon are not evaluated at all (cf_sum leaves them out). With the default
+	 * threshold 0, only the components of weight 0 are skipped, which gives exactly the result of
+	 * evaluating all of them.
+	 */
+
+	/* Weights of the components given the squared distances w to their optima (in place). Returns their sum */
+	double cf_norm(double *w, int nx, int cf_num) const{
+		int i;
+		double w_max=0,w_sum=0;
+		for (i=0; i<cf_num; i++)
+		{
+			if (w[i]!=0)
+				w[i]=pow(1.0/w[i],0.5)*exp(-w[i]/2.0/nx/pow(spec->comp[i].delta,2.0));
+			else
+				w[i]=INF;
+			if (w[i]>w_max)
+				w_max=w[i];
+		}
+
+		for (i=0; i<cf_num; i++)
+		{
+			w_sum=w_sum+w[i];
+		}
+		if(w_max==0)
+		{
+			for (i=0; i<cf_num; i++)
+				w[i]=1;
+			w_sum=cf_num;
+		}
+		return w_sum;
+	}
+
+	/* Weights of the components at the point x, and components which have to be evaluated. Returns the sum of the weights */
+	double cf_weights(const double *x, int nx, double *w, bool *compute) const{
+		int i;
+		for (i=0; i<spec->cf_num; i++)
+		{
+			w[i]=kern->distsq(x, &OShift[i*nx], nx);
+		}
+		double w_sum=cf_norm(w, nx, spec->cf_num);
+		for (i=0; i<spec->cf_num; i++)
+			compute[i]=!(w[i]/w_sum<=_cfEpsilon);
+		return w_sum;
+	}
+
+	/* Mixing of the components, given their fitness without bias. Only the components with compute[i] are added (all if it is NULL) */
+	double cf_sum(const double *w, double w_sum, const double *fit, const bool *compute) const{
+		int i;
+		double f = 0.0;
+		for (i=0; i<spec->cf_num; i++)
+		{
+			if (compute==NULL || compute[i])
+				f=f+w[i]/w_sum*(fit[i]+spec->comp[i].bias);
+		}
+		return f;
+	}
+
+	/*
+	 * Unrotated separable functions (sphere, different powers, Rastrigin, Schwefel and bi-Rastrigin
+	 * with r_flag=0, and the composition of unrotated Schwefel functions) are sums of per-dimension
+	 * terms. As the parameters are integers in 0..200, every term is tabulated at construction
+	 * and the evaluation only adds table entries.
+	 */
+
+	/* Number of per-dimension terms of a separable basic function (0 if it is not separable) */
+	static int numterms (int kernel){
+		switch(kernel)
+		{
+			case SPHERE:
+			case DIF_POWERS:
+			case RASTRIGIN:
+			case SCHWEFEL:
+				return 1;
+			case BI_RASTRIGIN:
+				return 3;
+			default:
+				return 0;
+		}
+	}
+
+	/* Terms of the dimension i of an unrotated separable basic function, given the output y of shrinkfunc */
+	void separableterms (int kernel, double y, int i, double *t) const{
+		int nx=_Dsize;
+		double z,tmp,tmpx,mu0=2.5;
+		switch(kernel)
 		{
-			xrot[i]=0;
-				for (j=0; j<nx; j++)
+			case SPHERE:
+				t[0]=y*y;
+				break;
+			case DIF_POWERS:
+				t[0]=pow(fabs(y),_difExp[i]);
+				break;
+			case RASTRIGIN:
+				z=asyelem(oszelem(y, i, nx), y, i, nx, 0.2);
+				z*=_cond10[i];
+				t[0]=(z*z - 10.0*cos(2.0*PI*z) + 10.0);
+				break;
+			case SCHWEFEL:
+				z=y*_cond10[i];
+				z=z+4.209687462275036e+002;
+				t[0]=0;
+				if (z>500)
+				{
+					t[0]-=(500.0-fmod(z,500))*sin(pow(500.0-fmod(z,500),0.5));
+					tmp=(z-500.0)/100;
+					t[0]+= tmp*tmp/nx;
+				}
+				else if (z<-500)
 				{
-					xrot[i]=xrot[i]+x[j]*Mr[i*nx+j];
+					t[0]-=(-500.0+fmod(fabs(z),500))*sin(pow(500.0-fmod(fabs(z),500),0.5));
+					tmp=(z+500.0)/100;
+					t[0]+= tmp*tmp/nx;
 				}
+				else
+					t[0]-=z*sin(pow(fabs(z),0.5));
+				break;
+			case BI_RASTRIGIN:
+				tmpx=y+mu0;
+				tmp=tmpx-mu0;
+				t[0]=tmp*tmp;
+				tmp=tmpx-_biMu1;
+				t[1]=tmp*tmp;
+				z=y*_cond100[i];
+				t[2]=cos(2.0*PI*z);
+				break;
 		}
 	}
 
-	void asyfunc (double *x, double *xasy, int nx, double beta){
-		int i;
+	/* Value of an unrotated separable basic function from the sums of its terms */
+	double separablefinish (int kernel, const double *t) const{
+		int nx=_Dsize;
+		double d=1.0,tmp1,tmp2;
+		switch(kernel)
+		{
+			case DIF_POWERS:
+				return pow(t[0],0.5);
+			case SCHWEFEL:
+				return 4.189828872724338e+002*nx+t[0];
+			case BI_RASTRIGIN:
+				tmp1=t[0];
+				tmp2=t[1]*_biS;
+				tmp2+=d*nx;
+				return ((tmp1<tmp2)?tmp1:tmp2)+10.0*(nx-t[2]);
+			default:
+				return t[0];
+		}
+	}
+
+	/* Entry of the table for the sum k, the dimension i and the parameter value v */
+	double &tableentry (int k, int i, int v){
+		return _table[(k*_Dsize+i)*_numValues+v];
+	}
+
+	double tableentry (int k, int i, int v) const{
+		return _table[(k*_Dsize+i)*_numValues+v];
+	}
+
+	/* Computation of the conditioning constants, with the same expressions the basic functions used, so the results do not change */
+	void buildconditioning (){
+		int i,nx=_Dsize;
+		_cond6.resize(nx);
+		_cond10.resize(nx);
+		_cond100.resize(nx);
+		_sqrt1.resize(nx);
+		_difExp.resize(nx);
 		for (i=0; i<nx; i++)
 		{
-			if (x[i]>0)
-			xasy[i]=pow(x[i],1.0+beta*i/(nx-1)*pow(x[i],0.5));
+			_cond6[i]=pow(10.0,6.0*i/(nx-1));
+			_cond10[i]=pow(10.0,1.0*i/(nx-1)/2.0);
+			_cond100[i]=pow(100.0,1.0*i/(nx-1)/2.0);
+			_sqrt1[i]=sqrt(1.0+i);
+			_difExp[i]=2+4*i/(nx-1);
 		}
+		_katsuuraExp=10.0/pow(1.0*nx,1.2);
+		_biS=1.0-1.0/(2.0*pow(nx+20.0,0.5)-8.2);
+		_biMu1=-pow((2.5*2.5-1.0)/_biS,0.5);
 	}
 
-	void oszfunc (double *x, double *xosz, int nx){
-		int i,sx;
-		double c1,c2,xx;
+	/* Construction of the tables, only for the test functions which are sums of per-dimension terms */
+	void buildtables (){
+		int c,i,k,v,nx=_Dsize;
+		int ncomp=(spec->cf_num>0)?spec->cf_num:1;
+		double t[3];
+
+		_numSums=0;
+		for (c=0; c<ncomp; c++)
+			if (spec->comp[c].r_flag!=0 || numterms(spec->comp[c].kernel)==0)
+				return;
+		for (c=0; c<ncomp; c++)
+		{
+			_sumOffset[c]=_numSums;
+			_numSums+=numterms(spec->comp[c].kernel);
+		}
+		//The composition also needs the squared distance to the optimum of each component
+		if (spec->cf_num>0)
+			_numSums+=spec->cf_num;
+
+		_numValues=_Dmax[0]+1;
+		_table.resize(_numSums*nx*_numValues);
 		for (i=0; i<nx; i++)
+			for (v=0; v<_numValues; v++)
+			{
+				double xi=v-100;
+				for (c=0; c<ncomp; c++)
+				{
+					const FuncComponent &comp=spec->comp[c];
+					separableterms(comp.kernel, shrinkfunc(xi, OShift[c*nx+i], comp.kernel), i, t);
+					for (k=0; k<numterms(comp.kernel); k++)
+						tableentry(_sumOffset[c]+k, i, v)=t[k];
+					if (spec->cf_num>0)
+						tableentry(_numSums-spec->cf_num+c, i, v)=pow(xi-OShift[c*nx+i],2.0);
+				}
+			}
+	}
+
+	/* Evaluation of a tabulated test function from the sums of its terms */
+	double tablefitness (const double *sums) const{
+		int c;
+		int ncomp=(spec->cf_num>0)?spec->cf_num:1;
+		double f,fit[5],dist[5];
+
+		for (c=0; c<ncomp; c++)
 		{
-			if (i==0||i==nx-1)
+			const FuncComponent &comp=spec->comp[c];
+			fit[c]=separablefinish(comp.kernel, &sums[_sumOffset[c]]);
+			if (spec->cf_num>0)
 			{
-				if (x[i]!=0)
-					xx=log(fabs(x[i]));
-				if (x[i]>0)
-				{	
-					c1=10;
-					c2=7.9;
+				fit[c]=comp.lambda_num*fit[c]/comp.lambda_den;
+				dist[c]=sums[_numSums-spec->cf_num+c];
+			}
+		}
+		if (spec->cf_num>0)
+			f=cf_sum(dist, cf_norm(dist, _Dsize, spec->cf_num), fit, NULL);
+		else
+			f=fit[0];
+		return f+spec->bias;
+	}
+
+	/*
+	 * Evaluation of the test function. If state is NULL, the point is read from ws._x. Otherwise the
+	 * cached vectors of the state are used and, if index is not negative, the parameter index is
+	 * considered to take the value value instead of the cached one. The state is not modified.
+	 */
+	template<int ND>
+	double statefitness(const FuncState *state, int index, int value, FuncWorkspace &ws) const{
+		int c,i,nx=(ND>0)?ND:_Dsize;
+		int ncomp=(spec->cf_num>0)?spec->cf_num:1;
+		double f,fit[5],w_sum=0;
+		double xi=value-100;
+		double *y=&ws._y[0], *z=&ws._z[0], *w=&ws._w[0];
+		bool compute[5]={true,true,true,true,true};
+
+		if (state!=NULL && _numSums>0)
+		{
+			double sums[20];
+			for (c=0; c<_numSums; c++)
+			{
+				sums[c]=state->_sums[c];
+				if (index>=0)
+					sums[c]+=tableentry(c, index, value)-tableentry(c, index, state->_params[index]);
+			}
+			return tablefitness(sums);
+		}
+
+		//Weights of the components first, so that the negligible ones are not evaluated
+		if (spec->cf_num>0)
+		{
+			if (state!=NULL)
+			{
+				for (i=0; i<nx; i++)
+					ws._x[i]=state->_x[i];
+				if (index>=0)
+					ws._x[index]=xi;
+			}
+			w_sum=cf_weights(&ws._x[0], nx, &ws._cf[0], compute);
+		}
+
+		for (c=0; c<ncomp; c++)
+		{
+			if (!compute[c])
+				continue;
+			const FuncComponent &comp=spec->comp[c];
+			const double *Os=&OShift[c*nx];
+			if (state==NULL)
+				headfunc<ND>(&ws._x[0], y, z, nx, Os, c, comp.r_flag, comp.kernel);
+			else
+			{
+				for (i=0; i<nx; i++)
+				{
+					y[i]=state->_y[c*nx+i];
+					z[i]=state->_z[c*nx+i];
 				}
-				else
+				if (index>=0)
+				{
+					double yi=shrinkfunc(xi, Os[index], comp.kernel);
+					if (comp.r_flag==1)
+						axpycolumn(z, yi-y[index], c, index, nx);
+					else
+						z[index]=yi;
+					y[index]=yi;
+				}
+			}
+			tailfunc<ND>(comp.kernel, y, z, w, &fit[c], nx, c, comp.r_flag);
+			if (spec->cf_num>0)
+				fit[c]=comp.lambda_num*fit[c]/comp.lambda_den;
+		}
+
+		if (spec->cf_num>0)
+			f=cf_sum(&ws._cf[0], w_sum, fit, compute);
+		else
+			f=fit[0];
+		return f+spec->bias;
+	}
+
+	/* Workspace used when the caller does not provide one: one per thread */
+	static FuncWorkspace &defaultworkspace(){
+		static thread_local FuncWorkspace ws;
+		return ws;
+	}
+
+	/* Incremental update of the cached vectors when the parameter index takes the value value */
+	void updatestate(FuncState &state, int index, int value) const{
+		int c,nx=_Dsize;
+		int ncomp=(spec->cf_num>0)?spec->cf_num:1;
+		double xi=value-100;
+
+		if (_numSums>0)
+			for (c=0; c<_numSums; c++)
+				state._sums[c]+=tableentry(c, index, value)-tableentry(c, index, state._params[index]);
+		else
+		for (c=0; c<ncomp; c++)
+		{
+			const FuncComponent &comp=spec->comp[c];
+			double yi=shrinkfunc(xi, OShift[c*nx+index], comp.kernel);
+			double *zc=&state._z[c*nx];
+			if (comp.r_flag==1)
+				axpycolumn(zc, yi-state._y[c*nx+index], c, index, nx);
+			else
+				zc[index]=yi;
+			state._y[c*nx+index]=yi;
+		}
+		state._x[index]=xi;
+		state._params[index]=value;
+		state._numUpdates++;
+	}
+
+	/* Body of sweep, for the dimension ND (see the *_tail functions) */
+	template<int ND>
+	void sweepfunc(const FuncState &state, int indexParam, std::vector<double> &fitness, FuncWorkspace &ws) const{
+		int c,i,v,nx=(ND>0)?ND:_Dsize,numValues=_Dmax[indexParam]+1;
+		double f,fit[5],a[5],b[5],w_sum=0;
+		bool compute[5]={true,true,true,true,true};
+
+		fitness.resize(numValues);
+		if (spec==NULL)
+		{
+			printf("\nError: There are only 28 test functions in this test suite!\n");
+			for (v=0; v<numValues; v++)
+				fitness[v]=-0.0;
+			return;
+		}
+
+		if (_numSums>0)
+		{
+			double sums[20];
+			int old=state._params[indexParam];
+			for (v=0; v<numValues; v++)
+			{
+				for (c=0; c<_numSums; c++)
+					sums[c]=state._sums[c]+(tableentry(c, indexParam, v)-tableentry(c, indexParam, old));
+				fitness[v]=-tablefitness(sums);
+			}
+			return;
+		}
+
+		int ncomp=(spec->cf_num>0)?spec->cf_num:1;
+		ws.reserve(nx);
+		double *y=&ws._y[0], *z=&ws._z[0], *w=&ws._w[0];
+		for (c=0; c<ncomp; c++)
+			shrinkscale(spec->comp[c].kernel, a[c], b[c]);
+		if (spec->cf_num>0)
+			for (i=0; i<nx; i++)
+				ws._x[i]=state._x[i];
+
+		for (v=0; v<numValues; v++)
+		{
+			double xi=v-100;
+			if (spec->cf_num>0)
+			{
+				ws._x[indexParam]=xi;
+				w_sum=cf_weights(&ws._x[0], nx, &ws._cf[0], compute);
+			}
+			for (c=0; c<ncomp; c++)
+			{
+				if (!compute[c])
+					continue;
+				const FuncComponent &comp=spec->comp[c];
+				double Os=OShift[c*nx+indexParam];
+				double yi=(xi-Os)*a[c]/b[c];
+				if (comp.kernel==BI_RASTRIGIN && Os < 0.)
+					yi *= -1.;
+				for (i=0; i<nx; i++)
 				{
-					c1=5.5;
-					c2=3.1;
-				}	
-				if (x[i]>0)
-					sx=1;
-				else if (x[i]==0)
-					sx=0;
+					y[i]=state._y[c*nx+i];
+					z[i]=state._z[c*nx+i];
+				}
+				if (comp.r_flag==1)
+					axpycolumn(z, yi-y[indexParam], c, indexParam, nx);
 				else
-					sx=-1;
-				xosz[i]=sx*exp(xx+0.049*(sin(c1*xx)+sin(c2*xx)));
+					z[indexParam]=yi;
+				y[indexParam]=yi;
+				tailfunc<ND>(comp.kernel, y, z, w, &fit[c], nx, c, comp.r_flag);
+				if (spec->cf_num>0)
+					fit[c]=comp.lambda_num*fit[c]/comp.lambda_den;
 			}
+
+			if (spec->cf_num>0)
+				f=cf_sum(&ws._cf[0], w_sum, fit, compute);
 			else
-				xosz[i]=x[i];
+				f=fit[0];
+			fitness[v]=-(f+spec->bias);
 		}
 	}
 
-	void cf_cal(double *x, double *f, int nx, double *Os,double * delta,double * bias,double * fit, int cf_num){
-	int i,j;
-	double *w;
-	double w_max=0,w_sum=0;
-	w=(double *)malloc(cf_num * sizeof(double));
-	for (i=0; i<cf_num; i++)
-	{
-		fit[i]+=bias[i];
-		w[i]=0;
-		for (j=0; j<nx; j++)
+	/* Body of fitnessBatch, for the dimension ND (see the *_tail functions) */
+	template<int ND>
+	void batchfunc(const std::vector<const RPOGene*> &parameters, std::vector<double> &fitness,
+			FuncWorkspace &ws) const{
+		int b,c,i,s,nb,nx=(ND>0)?ND:_Dsize,n=(int)parameters.size();
+		double f,fit[FUNC_BATCH][5],wb[FUNC_BATCH][5],w_sum[FUNC_BATCH];
+		bool compute[FUNC_BATCH][5];
+
+		fitness.resize(n);
+		if (spec==NULL || _numSums>0)
 		{
-			w[i]+=pow(x[j]-Os[i*nx+j],2.0);
+			for (s=0; s<n; s++)
+				fitness[s]=this->fitness(parameters[s], ws);
+			return;
+		}
+
+		int ncomp=(spec->cf_num>0)?spec->cf_num:1;
+		ws.reserve(nx);
+		double *y=&ws._y[0], *z=&ws._z[0], *w=&ws._w[0];
+		for (b=0; b<n; b+=FUNC_BATCH)
+		{
+			nb=(n-b<FUNC_BATCH)?n-b:FUNC_BATCH;
+			//Weights of the components of every solution, so that the negligible ones are not evaluated
+			for (s=0; s<nb; s++)
+			{
+				for (c=0; c<ncomp; c++)
+					compute[s][c]=true;
+				if (spec->cf_num>0)
+				{
+					const RPOGene *p=parameters[b+s];
+					for (i=0; i<nx; i++)
+						ws._x[i]=p[i]-100;
+					w_sum[s]=cf_weights(&ws._x[0], nx, wb[s], compute[s]);
+				}
+			}
+
+			for (c=0; c<ncomp; c++)
+			{
+				const FuncComponent &comp=spec->comp[c];
+				const double *Os=&OShift[c*nx];
+				bool any=false;
+				for (s=0; s<nb; s++)
+					any=any||compute[s][c];
+				if (!any)
+					continue;
+				for (s=0; s<nb; s++)
+				{
+					const RPOGene *p=parameters[b+s];
+					for (i=0; i<nx; i++)
+						ws._by[i*FUNC_BATCH+s]=shrinkfunc(p[i]-100, Os[i], comp.kernel);
+				}
+				if (comp.r_flag==1)
+					rotateblockfunc(&ws._by[0], &ws._bz[0], nx, c);
+				for (s=0; s<nb; s++)
+				{
+					if (!compute[s][c])
+						continue;
+					for (i=0; i<nx; i++)
+					{
+						y[i]=ws._by[i*FUNC_BATCH+s];
+						z[i]=(comp.r_flag==1)?ws._bz[i*FUNC_BATCH+s]:y[i];
+					}
+					tailfunc<ND>(comp.kernel, y, z, w, &fit[s][c], nx, c, comp.r_flag);
+					if (spec->cf_num>0)
+						fit[s][c]=comp.lambda_num*fit[s][c]/comp.lambda_den;
+				}
+			}
+
+			for (s=0; s<nb; s++)
+			{
+				if (spec->cf_num>0)
+					f=cf_sum(wb[s], w_sum[s], fit[s], compute[s]);
+				else
+					f=fit[s][0];
+				fitness[b+s]=-(f+spec->bias);
+			}
 		}
-		if (w[i]!=0)
-			w[i]=pow(1.0/w[i],0.5)*exp(-w[i]/2.0/nx/pow(delta[i],2.0));
-		else
-			w[i]=INF;
-		if (w[i]>w_max)
-			w_max=w[i];
 	}
 
-	for (i=0; i<cf_num; i++)
-	{
-		w_sum=w_sum+w[i];
+	/* Evaluation functions specialised for a dimension */
+	struct FuncImpl {
+		double (Func::*statefitness)(const FuncState *state, int index, int value, FuncWorkspace &ws) const;
+		void (Func::*sweep)(const FuncState &state, int index, std::vector<double> &fitness, FuncWorkspace &ws) const;
+		void (Func::*batch)(const std::vector<const RPOGene*> &parameters, std::vector<double> &fitness,
+				FuncWorkspace &ws) const;
+	};
+
+	template<int ND>
+	static const FuncImpl *impl(){
+		static const FuncImpl functions={&Func::statefitness<ND>, &Func::sweepfunc<ND>, &Func::batchfunc<ND>};
+		return &functions;
 	}
-	if(w_max==0)
-	{
-		for (i=0; i<cf_num; i++)
-			w[i]=1;
-		w_sum=cf_num;
+
+	/* Choice of the specialisation for the dimension nx (the generic one if there is none) */
+	static const FuncImpl *selectimpl(int nx){
+		switch(nx)
+		{
+			case 2: return impl<2>();
+			case 5: return impl<5>();
+			case 10: return impl<10>();
+			case 20: return impl<20>();
+			case 30: return impl<30>();
+			case 50: return impl<50>();
+			case 100: return impl<100>();
+			default: return impl<0>();
+		}
 	}
-	f[0] = 0.0;
-    for (i=0; i<cf_num; i++)
-    {
-		f[0]=f[0]+w[i]/w_sum*fit[i];
-    }
-	free(w);
-}
-	
+
     public:
-    Func(int nx, int constrfunc_num): _Dsize(nx), func_num(constrfunc_num){
+	/**
+	 * Evaluation state of the solutions (see RPOObjective::State)
+	 */
+	typedef FuncState State;
+
+	/**
+	 * Seed of the generated data used by default
+	 */
+	static constexpr uint64_t DEFAULT_DATA_SEED=2013;
+
+	/**
+	 * Maximum size of the groups of the grouped rotations
+	 */
+	static constexpr int MAX_GROUP_SIZE=256;
+
+	/**
+	 * Constructor
+	 * @param[in] nx Dimension. The dimensions of CEC 2013 (2,5,10,20,30,...,100) use the data files
+	 *               of input_data; any other dimension (at least 2) uses rotation matrices and
+	 *               shifts generated from dataSeed (see FuncData)
+	 * @param[in] constrfunc_num Number of the test function (1-28)
+	 * @param[in] dataSeed Seed of the generated data (not used by the dimensions with data files)
+	 * @param[in] rotationGroup If it is 0, the rotations are dense D x D matrices, O(D^2) in time
+	 *                          and memory. Otherwise, they are grouped: the variables are split, in
+	 *                          a random order, into groups of at most rotationGroup variables, and
+	 *                          each group is rotated by its own orthogonal matrix (as the large
+	 *                          scale benchmarks do). The rotation is still orthogonal, but it takes
+	 *                          O(D*k) time and memory, and the change of a parameter updates O(k)
+	 *                          values. The matrices and the order are generated from dataSeed, also
+	 *                          in the dimensions with data files
+	 */
+    Func(int nx, int constrfunc_num, uint64_t dataSeed=DEFAULT_DATA_SEED, int rotationGroup=0): _Dsize(nx), func_num(constrfunc_num){
+		if (nx<2)
+		{
+			cerr<<endl<<"Error: Test functions are only defined for D>=2."<<endl;
+			exit(-3);
+		}
+		if (rotationGroup<0 || rotationGroup>MAX_GROUP_SIZE)
+		{
+			cerr<<endl<<"Error: The size of the groups of the rotations has to be between 0 and "<<MAX_GROUP_SIZE<<"."<<endl;
+			exit(-3);
+		}
 		_Dmax.clear();
 		_Dmax= vector<int>(_Dsize,200);
-		int cf_num=10,i;
-		ifstream fpt;
-		y=new double[nx];
-		z=new double [nx];
+		int cf_num=DATA_BLOCKS,i;
 		x_bound=new double [nx];
 		for (i=0; i<nx; i++)
 			x_bound[i]=100.0;
-
-		if (!(nx==2||nx==5||nx==10||nx==20||nx==30||nx==40||nx==50||nx==60||nx==70||nx==80||nx==90||nx==100))
+		spec=getspec(func_num);
+		//Rotated Ackley is too sensitive to the rounding of the first rotation and of the
+		//elementary functions (see _fullDelta): it uses the C library and full evaluations
+		_fullDelta=(spec!=NULL && spec->cf_num==0 && spec->comp[0].kernel==ACKLEY && spec->comp[0].r_flag==1);
+		kern=_fullDelta?&FuncKernels::getstrict():&FuncKernels::get();
+		_impl=selectimpl(nx);
+
+		//The matrices (and their transposed copies) and the shifts are shared by all the instances of the same dimension
+		if (FuncData::hasfiles(nx))
+			OShift=FuncData::shifts(nx, cf_num);
+		else
+			OShift=FuncData::generatedshifts(nx, cf_num, dataSeed);
+		_groupSize=_numGroups=0;
+		if (rotationGroup>0)
 		{
-			cerr<<endl<<"Error: Test functions are only defined for D=2,5,10,20,30,40,50,60,70,80,90,100."<<endl;
-			exit(-3);
+			//Groups of similar sizes: the same number of groups, with the smallest size
+			_numGroups=(nx+rotationGroup-1)/rotationGroup;
+			_groupSize=(nx+_numGroups-1)/_numGroups;
+			_numGroups=(nx+_groupSize-1)/_groupSize;
+			_numBlocks=GENERATED_BLOCKS;
+			FuncData::groupedmatrices(nx, _groupSize, _numBlocks, dataSeed, M, MT);
+			_perm.resize((size_t) _numBlocks*nx);
+			_position.resize(_perm.size());
+			for (int c=0; c<_numBlocks; c++)
+			{
+				FuncData::permutation(&_perm[(size_t) c*nx], nx, dataSeed^(0xBB67AE8584CAA73BULL+c));
+				for (i=0; i<nx; i++)
+					_position[(size_t) c*nx+_perm[(size_t) c*nx+i]]=i;
+			}
 		}
-		char FileName[30];
-		sprintf(FileName, "input_data/M_D%d.txt", nx);
-		fpt.open(FileName);
-		if (!fpt.is_open())
+		else if (FuncData::hasfiles(nx))
 		{
-			cerr<<endl<<"Error: Cannot open input file for reading"<<endl;
-			exit(-4);
+			FuncData::matrices(nx, cf_num, M, MT);
+			_numBlocks=cf_num;
 		}
-
-		M=new double[cf_num*nx*nx];
-		for (i=0; i<cf_num*nx*nx; i++)
+		else
 		{
-				fpt>>M[i];
+			_numBlocks=GENERATED_BLOCKS;
+			FuncData::generatedmatrices(nx, _numBlocks, dataSeed, M, MT);
 		}
-		fpt.close();
-		
+		Mf=MTf=NULL;
 
-		fpt.open("input_data/shift_data.txt");
-		if (!fpt.is_open())
-		{
-			cerr<<endl<<"Error: Cannot open input file for reading"<<endl;
-			exit(-4);
-		}
-		OShift=new double[nx*cf_num];
-		for(i=0;i<cf_num*nx;i++)
-		{
-				fpt>>OShift[i];
-		}
-		fpt.close();
+		_cfEpsilon=0.0;
+		_numSums=0;
+		buildconditioning();
+		if (spec!=NULL)
+			buildtables();
     }
-    
+
 	~Func(){
-		delete[] y;
-		delete[] z;
-		delete[] M;
-		delete[] OShift;
 		delete[] x_bound;
 	}
-	
-	const int getNumParameters(){
+
+	const int getNumParameters() const{
         return _Dsize;
     }
 
-    const int getWidthOfParameter(int indexParam){
+	int getFunctionNumber() const{
+		return func_num;
+	}
+
+    const int getWidthOfParameter(int indexParam) const{
         return _Dmax.at(indexParam)+1;
     }
-	
-    double fitness(const std::vector<int> &parameters) {
-		double f;
-		double*x =new double[_Dsize];
-		for(int i=0;i<_Dsize;i++)
-			x[i]=parameters[i]-100;
-		int nx=_Dsize;
-        switch(func_num)
+
+	/**
+	 * Number of solutions evaluated together by fitnessBatch
+	 */
+	int getBatchSize() const{
+		return FUNC_BATCH;
+	}
+
+	/**
+	 * Function which sets the threshold of the composition functions (21-28): the components whose
+	 * weight, divided by the sum of the weights, is not above it are not evaluated. With 0 (the
+	 * default) the results are exact; with a small value such as 1e-12 the error of the fitness
+	 * is, at most, that fraction of the fitness of the skipped components.
+	 * @param[in] epsilon Threshold of the normalised weights
+	 */
+	void setCompositionEpsilon(double epsilon){
+		_cfEpsilon=epsilon;
+	}
+
+	/**
+	 * Function which sets the precision of the evaluation (see RPOObjective::PRECISION_DOUBLE).
+	 * It has to be set before any solution is evaluated, as the cached states (FuncState) are
+	 * computed with the matrices of the precision in use.
+	 * PRECISION_DOUBLE Everything in double precision (the default)
+	 * PRECISION_MIXED The rotation matrices are read in single precision, which halves the memory
+	 *                 read by the rotations (the largest part of the evaluation for large D). The
+	 *                 vectors, the products and the sums are still in double precision, so the
+	 *                 only error is the rounding of the matrices (a relative error of 2^-24 in
+	 *                 each element), which changes the fitness by about 1e-7 relative. The results
+	 *                 are the same in all the instruction sets, but not the same as in double
+	 *                 precision: the search should not mix fitness values of both precisions.
+	 *                 Rotated Ackley (8) does not offer it: the rounding of the matrices changes
+	 *                 the order of about half of the pairs of random solutions (see _fullDelta),
+	 *                 so it stays in double precision, with a warning.
+	 * @param[in] precision PRECISION_DOUBLE or PRECISION_MIXED
+	 */
+	void setPrecision(int precision){
+		size_t size=blockoffset(_numBlocks, 0, _Dsize);
+		if (precision==PRECISION_MIXED && _fullDelta)
 		{
-			case 1:	
-				sphere_func(x,&f,nx,OShift,M,0);
-				f+=-1400.0;
-				break;
-			case 2:	
-				ellips_func(x,&f,nx,OShift,M,1);
-				f+=-1300.0;
-				break;
-			case 3:	
-				bent_cigar_func(x,&f,nx,OShift,M,1);
-				f+=-1200.0;
-				break;
-			case 4:	
-				discus_func(x,&f,nx,OShift,M,1);
-				f+=-1100.0;
-				break;
-			case 5:
-				dif_powers_func(x,&f,nx,OShift,M,0);
-				f+=-1000.0;
-				break;
-			case 6:
-				rosenbrock_func(x,&f,nx,OShift,M,1);
-				f+=-900.0;
-				break;
-			case 7:	
-				schaffer_F7_func(x,&f,nx,OShift,M,1);
-				f+=-800.0;
-				break;
-			case 8:	
-				ackley_func(x,&f,nx,OShift,M,1);
-				f+=-700.0;
-				break;
-			case 9:	
-				weierstrass_func(x,&f,nx,OShift,M,1);
-				f+=-600.0;
-				break;
-			case 10:	
-				griewank_func(x,&f,nx,OShift,M,1);
-				f+=-500.0;
-				break;
-			case 11:	
-				rastrigin_func(x,&f,nx,OShift,M,0);
-				f+=-400.0;
-				break;
-			case 12:	
-				rastrigin_func(x,&f,nx,OShift,M,1);
-				f+=-300.0;
-				break;
-			case 13:	
-				step_rastrigin_func(x,&f,nx,OShift,M,1);
-				f+=-200.0;
-				break;
-			case 14:	
-				schwefel_func(x,&f,nx,OShift,M,0);
-				f+=-100.0;
-				break;
-			case 15:	
-				schwefel_func(x,&f,nx,OShift,M,1);
-				f+=100.0;
-				break;
-			case 16:	
-				katsuura_func(x,&f,nx,OShift,M,1);
-				f+=200.0;
-				break;
-			case 17:	
-				bi_rastrigin_func(x,&f,nx,OShift,M,0);
-				f+=300.0;
-				break;
-			case 18:	
-				bi_rastrigin_func(x,&f,nx,OShift,M,1);
-				f+=400.0;
-				break;
-			case 19:	
-				grie_rosen_func(x,&f,nx,OShift,M,1);
-				f+=500.0;
-				break;
-			case 20:	
-				escaffer6_func(x,&f,nx,OShift,M,1);
-				f+=600.0;
-				break;
-			case 21:	
-				cf01(x,&f,nx,OShift,M,1);
-				f+=700.0;
-				break;
-			case 22:	
-				cf02(x,&f,nx,OShift,M,0);
-				f+=800.0;
-				break;
-			case 23:	
-				cf03(x,&f,nx,OShift,M,1);
-				f+=900.0;
-				break;
-			case 24:	
-				cf04(x,&f,nx,OShift,M,1);
-				f+=1000.0;
-				break;
-			case 25:	
-				cf05(x,&f,nx,OShift,M,1);
-				f+=1100.0;
-				break;
-			case 26:
-				cf06(x,&f,nx,OShift,M,1);
-				f+=1200.0;
-				break;
-			case 27:
-				cf07(x,&f,nx,OShift,M,1);
-				f+=1300.0;
-				break;
-			case 28:
-				cf08(x,&f,nx,OShift,M,1);
-				f+=1400.0;
-				break;
-			default:
-				printf("\nError: There are only 28 test functions in this test suite!\n");
-				f = 0.0;
-				break;
+			cerr<<"Warning: Function "<<func_num<<" does not support the mixed precision; it is evaluated in double precision."<<endl;
+			precision=PRECISION_DOUBLE;
+		}
+		if (precision==PRECISION_MIXED)
+		{
+			Mf=FuncData::singlecopy(M, 2*size);
+			MTf=Mf+size;
+		}
+		else
+			Mf=MTf=NULL;
+	}
+
+	int getPrecision() const{
+		return (Mf!=NULL)?PRECISION_MIXED:PRECISION_DOUBLE;
+	}
+
+	/**
+	 * Function which fully computes the cached vectors of a state for the given parameters
+	 * @param[in] parameters Values of the parameters
+	 * @param[out] state State where the vectors are stored
+	 */
+	void initState(const RPOGene *parameters, FuncState &state) const{
+		int c,i,nx=_Dsize;
+		int ncomp=(spec!=NULL&&spec->cf_num>0)?spec->cf_num:1;
+
+		state._params.assign(parameters, parameters+nx);
+		state._x.resize(nx);
+		for (i=0; i<nx; i++)
+			state._x[i]=parameters[i]-100;
+		if (_numSums>0)
+		{
+			state._sums.assign(_numSums, 0.0);
+			for (c=0; c<_numSums; c++)
+				for (i=0; i<nx; i++)
+					state._sums[c]+=tableentry(c, i, parameters[i]);
+		}
+		else if (spec!=NULL)
+		{
+			state._y.resize(ncomp*nx);
+			state._z.resize(ncomp*nx);
+			for (c=0; c<ncomp; c++)
+				headfunc<0>(&state._x[0], &state._y[c*nx], &state._z[c*nx], nx, &OShift[c*nx], c,
+						spec->comp[c].r_flag, spec->comp[c].kernel);
+		}
+		state._numUpdates=0;
+		state._valid=true;
+	}
+
+	/**
+	 * Function which brings the cached vectors of a state up to date with the given parameters.
+	 * The parameters which have changed are updated incrementally, unless there are so many
+	 * changes (or the state has accumulated so many updates) that a full computation is preferable.
+	 * After D updates the cost of the updates has reached that of a full computation. Computing it
+	 * after D/4 or D/8 updates gives the same largest relative difference from a full evaluation
+	 * (about 1e-9, in Schaffer F7 (7) and the composition function 8 (28)), and even a single
+	 * update of a fresh state differs by 1.5e-10 (see tests/FuncAccuracyTest.cpp).
+	 * @param[in] parameters Values of the parameters
+	 * @param[in,out] state State to be updated
+	 */
+	void syncState(const RPOGene *parameters, FuncState &state) const{
+		int i,numChanges=0;
+		if (state._valid)
+			for (i=0; i<_Dsize; i++)
+				if (parameters[i]!=state._params[i])
+					numChanges++;
+
+		if (!state._valid || state._numUpdates+numChanges > (unsigned)_Dsize)
+		{
+			initState(parameters, state);
+			return;
+		}
+
+		for (i=0; i<_Dsize && numChanges>0; i++)
+			if (parameters[i]!=state._params[i])
+			{
+				updatestate(state, i, parameters[i]);
+				numChanges--;
+			}
+	}
+
+	/**
+	 * Function which evaluates the solution stored in a state, after changing one of its parameters.
+	 * The state is not modified.
+	 * @param[in] state State with the cached vectors of the solution
+	 * @param[in] indexParam Index of the parameter to change
+	 * @param[in] newParamValue New value of the parameter
+	 * @param[in,out] ws Scratch vectors for the evaluation
+	 * @return Fitness of the modified solution
+	 */
+	double fitness(const FuncState &state, int indexParam, int newParamValue, FuncWorkspace &ws) const{
+		if (spec==NULL)
+		{
+			printf("\nError: There are only 28 test functions in this test suite!\n");
+			return -0.0;
+		}
+		ws.reserve(_Dsize);
+		return -(this->*_impl->statefitness)(&state, indexParam, newParamValue, ws);
+	}
+
+	double fitness(const FuncState &state, int indexParam, int newParamValue) const{
+		return fitness(state, indexParam, newParamValue, defaultworkspace());
+	}
+
+	/**
+	 * Function which evaluates the solution stored in a state for every value of one of its
+	 * parameters. The work which does not depend on the value (the copy of the point for the
+	 * composition functions, the shrink factors, the table of the old value) is done once, and
+	 * every value only costs the update of the first rotation with a column of M and the rest of
+	 * the basic function. The state is not modified.
+	 * @param[in] state State with the cached vectors of the solution
+	 * @param[in] indexParam Index of the parameter to change
+	 * @param[out] fitness Fitness of the solution for each value of the parameter (0..width-1)
+	 * @param[in,out] ws Scratch vectors for the evaluation
+	 */
+	void sweep(const FuncState &state, int indexParam, std::vector<double> &fitness, FuncWorkspace &ws) const{
+		(this->*_impl->sweep)(state, indexParam, fitness, ws);
+	}
+
+	void sweep(const FuncState &state, int indexParam, std::vector<double> &fitness) const{
+		sweep(state, indexParam, fitness, defaultworkspace());
+	}
+
+	/**
+	 * Function which evaluates a solution. The parameters are read where they are (the shift
+	 * converts them to double), so no vector is built for the evaluation.
+	 * @param[in] parameters Values of the D parameters
+	 * @param[in,out] ws Scratch vectors for the evaluation
+	 * @return Fitness of the solution
+	 */
+	double fitness(const RPOGene *parameters, FuncWorkspace &ws) const{
+		if (spec==NULL)
+		{
+			printf("\nError: There are only 28 test functions in this test suite!\n");
+			return -0.0;
 		}
-		delete[]x;
-		return -f;
+		if (_numSums>0)
+		{
+			double sums[20];
+			for (int k=0; k<_numSums; k++)
+			{
+				sums[k]=0.0;
+				for (int i=0; i<_Dsize; i++)
+					sums[k]+=tableentry(k, i, parameters[i]);
+			}
+			return -tablefitness(sums);
+		}
+		ws.reserve(_Dsize);
+		for (int i=0; i<_Dsize; i++)
+			ws._x[i]=parameters[i]-100;
+		return -(this->*_impl->statefitness)(NULL, -1, 0, ws);
+	}
+
+    double fitness(const RPOGene *parameters) const{
+		return fitness(parameters, defaultworkspace());
     }
+
+	double fitness(const std::vector<RPOGene> &parameters) const{
+		return fitness(&parameters[0], defaultworkspace());
+	}
+
+	/**
+	 * Function which evaluates a solution after changing one of its parameters, from scratch (the
+	 * result is the same as that of fitness with the modified parameters)
+	 * @param[in] parameters Values of the D parameters
+	 * @param[in] indexParam Index of the parameter to change
+	 * @param[in] newParamValue New value of the parameter
+	 * @param[in,out] ws Scratch vectors for the evaluation
+	 * @return Fitness of the modified solution
+	 */
+	double fullfitness(const RPOGene *parameters, int indexParam, int newParamValue, FuncWorkspace &ws) const{
+		ws.reserve(_Dsize);
+		for (int i=0; i<_Dsize; i++)
+			ws._x[i]=parameters[i]-100;
+		ws._x[indexParam]=newParamValue-100;
+		return -(this->*_impl->statefitness)(NULL, -1, 0, ws);
+	}
+
+	/**
+	 * Functions of RPOObjective which evaluate the changes of a parameter: the state is brought up
+	 * to date with the parameters (see syncState), and the change is evaluated incrementally (see
+	 * fitness and sweep with a state). The functions which are too sensitive to the rounding of
+	 * the incremental update (see _fullDelta) are evaluated from scratch.
+	 */
+	double fitnessDelta(const RPOGene *parameters, FuncState &state, int indexParam, int newParamValue) const{
+		if (_fullDelta)
+			return fullfitness(parameters, indexParam, newParamValue, defaultworkspace());
+		syncState(parameters, state);
+		return fitness(state, indexParam, newParamValue);
+	}
+
+	void fitnessSweep(const RPOGene *parameters, FuncState &state, int indexParam, std::vector<double> &fitness) const{
+		if (_fullDelta)
+		{
+			FuncWorkspace &ws=defaultworkspace();
+			fitness.resize(getWidthOfParameter(indexParam));
+			for (int value=0; value<(int)fitness.size(); value++)
+				fitness[value]=fullfitness(parameters, indexParam, value, ws);
+			return;
+		}
+		syncState(parameters, state);
+		sweep(state, indexParam, fitness);
+	}
+
+	/**
+	 * Function which evaluates several solutions. They are processed in blocks of FUNC_BATCH, so
+	 * that the first rotation of a block is a single matrix-matrix product instead of one
+	 * matrix-vector product per solution. The results are the same as those of fitness.
+	 * @param[in] parameters Values of the parameters of each solution
+	 * @param[out] fitness Fitness of each solution
+	 * @param[in,out] ws Scratch vectors for the evaluation
+	 */
+	void fitnessBatch(const std::vector<const RPOGene*> &parameters, std::vector<double> &fitness,
+			FuncWorkspace &ws) const{
+		(this->*_impl->batch)(parameters, fitness, ws);
+	}
+
+	void fitnessBatch(const std::vector<const RPOGene*> &parameters, std::vector<double> &fitness) const{
+		fitnessBatch(parameters, fitness, defaultworkspace());
+	}
 };
 
 
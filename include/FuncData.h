@@ -0,0 +1,438 @@
+/*
+ * FuncData.h
+ *
+ * File defining the loader of the data of the test functions (rotation matrices and shifts).
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef P1_FUNCDATA_H
+#define P1_FUNCDATA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+
+/**
+ * Class which loads the data files of the test functions. The text files are parsed only once:
+ * their values are stored in a binary file next to them (M_D<D>.bin, shift_data_D<D>.bin), which is
+ * mapped read-only into memory by every later instance. Therefore, the processes which use the
+ * same files share the same physical pages, and the construction of an instance does not parse
+ * anything. Inside a process, every file is mapped once and shared by all the instances (and
+ * threads); the mappings are kept until the process finishes.
+ *
+ * Binary format (native byte order, so it is rebuilt if it was created in another architecture):
+ * a header of 64 bytes (FuncDataHeader) followed by the values as doubles, 64-byte aligned. For
+ * the matrices, the transposed copy of every block follows the original values. The header keeps
+ * the size and modification time of the text file, so the binary file is rebuilt if the text
+ * file changes. If the text file does not exist, the binary one is used as it is.
+ *
+ * If the binary file cannot be written (for example, in a read-only directory), the values are
+ * kept in memory, shared only inside the process.
+ *
+ * The dimensions without data files (see hasfiles) use generated data: random orthogonal matrices
+ * (Gram-Schmidt orthonormalisation of matrices of normal random numbers, as the matrices of CEC
+ * 2013) and shifts uniformly distributed in [-80,80], obtained from a seed. The random numbers are
+ * produced by splitmix64, so the same seed gives the same data in every run and platform. The
+ * generated values are cached in binary files in the same way (M_D<D>_S<seed>.bin and
+ * shift_D<D>_S<seed>.bin), with the seed in the header.
+ *
+ * The grouped rotations (see Func) use blocks of groupSize x groupSize values: each group of
+ * variables has its own small orthogonal matrix, and the last group, which may be smaller, is
+ * completed with the identity. They are cached in G_D<D>_K<groupSize>_S<seed>.bin.
+ *
+ * If the environment variable FUNC_DATA_CACHE is 0, the binary files are neither read nor written.
+ */
+class FuncData {
+
+	/* Header of the binary files */
+	struct FuncDataHeader {
+		char magic[8];
+		uint32_t version, byteOrder;
+		uint64_t numValues, blockSize, sourceSize;
+		int64_t sourceTime;
+		uint64_t seed;
+		char reserved[8];
+	};
+
+	/* Generator of the values of the dimensions without data files */
+	typedef void (*Generator)(double *data, size_t numValues, size_t blockSize, int nx, uint64_t seed);
+
+	static const uint32_t DATA_VERSION = 1;
+	static const uint32_t DATA_BYTE_ORDER = 0x01020304;
+
+	/* Registry of the loaded files (name of the binary file -> values) */
+	static std::map<std::string, const double*> &registry(){
+		static std::map<std::string, const double*> files;
+		return files;
+	}
+
+	/* Registry of the copies in single precision (values in double precision -> copy) */
+	static std::map<const double*, const float*> &floatregistry(){
+		static std::map<const double*, const float*> copies;
+		return copies;
+	}
+
+	static std::mutex &registrymutex(){
+		static std::mutex m;
+		return m;
+	}
+
+	/* Header that a binary file created now from the text file would have */
+	static void expectedheader(FuncDataHeader &h, const struct stat &st, bool hasText, size_t numValues, size_t blockSize, uint64_t seed){
+		memset(&h, 0, sizeof(h));
+		h.seed = seed;
+		memcpy(h.magic, "RPOFUNC", 8);
+		h.version = DATA_VERSION;
+		h.byteOrder = DATA_BYTE_ORDER;
+		h.numValues = numValues;
+		h.blockSize = blockSize;
+		if (hasText)
+		{
+			h.sourceSize = st.st_size;
+			h.sourceTime = st.st_mtime;
+		}
+	}
+
+	/* Mapping of a valid binary file, or NULL */
+	static const double *mapbinary(const std::string &binFile, const FuncDataHeader &expected, bool hasText){
+		int fd = open(binFile.c_str(), O_RDONLY);
+		if (fd < 0)
+			return NULL;
+
+		size_t numDoubles = expected.numValues * (expected.blockSize > 0 ? 2 : 1);
+		size_t length = sizeof(FuncDataHeader) + numDoubles * sizeof(double);
+		FuncDataHeader h;
+		struct stat st;
+		bool valid = fstat(fd, &st) == 0 && (size_t) st.st_size == length
+				&& read(fd, &h, sizeof(h)) == (ssize_t) sizeof(h)
+				&& memcmp(h.magic, expected.magic, 8) == 0 && h.version == expected.version
+				&& h.byteOrder == expected.byteOrder && h.numValues == expected.numValues
+				&& h.blockSize == expected.blockSize && h.seed == expected.seed
+				&& (!hasText || (h.sourceSize == expected.sourceSize && h.sourceTime == expected.sourceTime));
+		void *data = MAP_FAILED;
+		if (valid)
+			data = mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (data == MAP_FAILED)
+			return NULL;
+		return (const double*) ((const char*) data + sizeof(FuncDataHeader));
+	}
+
+	/* Writing of the binary file. It is written with a temporary name and renamed, so that other processes never see it incomplete */
+	static bool writebinary(const std::string &binFile, const FuncDataHeader &h, const double *values, size_t numDoubles){
+		char tmpFile[512];
+		snprintf(tmpFile, sizeof(tmpFile), "%s.%d.tmp", binFile.c_str(), (int) getpid());
+		FILE *f = fopen(tmpFile, "wb");
+		if (f == NULL)
+			return false;
+		bool ok = fwrite(&h, sizeof(h), 1, f) == 1 && fwrite(values, sizeof(double), numDoubles, f) == numDoubles;
+		ok = (fclose(f) == 0) && ok;
+		if (ok)
+			ok = rename(tmpFile, binFile.c_str()) == 0;
+		if (!ok)
+			remove(tmpFile);
+		return ok;
+	}
+
+	/* Whether the binary files can be used (see FUNC_DATA_CACHE) */
+	static bool caching(){
+		const char *cache = getenv("FUNC_DATA_CACHE");
+		return cache == NULL || strcmp(cache, "0") != 0;
+	}
+
+	/* Random numbers of the generated data: splitmix64, uniform in [0,1) and normal (polar method) */
+	static uint64_t nextrandom(uint64_t &state){
+		uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	}
+
+	static double uniform(uint64_t &state){
+		return (nextrandom(state) >> 11) * (1.0/9007199254740992.0);
+	}
+
+	static double gaussian(uint64_t &state){
+		double u,v,r;
+		do
+		{
+			u = 2.0*uniform(state)-1.0;
+			v = 2.0*uniform(state)-1.0;
+			r = u*u+v*v;
+		} while (r >= 1.0 || r == 0.0);
+		return u*sqrt(-2.0*log(r)/r);
+	}
+
+	/* Random orthogonal matrix of n x n values, whose rows are stride values apart (modified Gram-Schmidt on the rows) */
+	static void orthogonal(double *Q, size_t n, size_t stride, uint64_t &state){
+		size_t i,j,k;
+		for (i=0; i<n; i++)
+		{
+			double *r = &Q[i*stride], norm = 0.0;
+			for (j=0; j<n; j++)
+				r[j] = gaussian(state);
+			for (k=0; k<i; k++)
+			{
+				const double *q = &Q[k*stride];
+				double d = 0.0;
+				for (j=0; j<n; j++)
+					d += r[j]*q[j];
+				for (j=0; j<n; j++)
+					r[j] -= d*q[j];
+			}
+			for (j=0; j<n; j++)
+				norm += r[j]*r[j];
+			norm = sqrt(norm);
+			for (j=0; j<n; j++)
+				r[j] /= norm;
+		}
+	}
+
+	/* Random orthogonal matrices: each block comes from its own sequence, so the first blocks do not depend on the number of blocks */
+	static void generaterotations(double *data, size_t numValues, size_t blockSize, int nx, uint64_t seed){
+		size_t n = blockSize, block = n*n;
+		for (size_t b=0; b<numValues/block; b++)
+		{
+			uint64_t state = seed ^ ((n << 32) + b);
+			orthogonal(&data[b*block], n, n, state);
+		}
+	}
+
+	/* Matrices of the groups of nx variables (blocks of blockSize x blockSize, the last group of every matrix completed with the identity) */
+	static void generategroups(double *data, size_t numValues, size_t blockSize, int nx, uint64_t seed){
+		size_t n = blockSize, block = n*n, groups = (nx+n-1)/n, b,i,size;
+		for (b=0; b<numValues/block; b++)
+		{
+			uint64_t state = (seed + 0x6A09E667F3BCC908ULL) ^ ((n << 32) + b);
+			double *Gb = &data[b*block];
+			size = nx-(b%groups)*n;
+			if (size > n)
+				size = n;
+			memset(Gb, 0, block*sizeof(double));
+			for (i=size; i<n; i++)
+				Gb[i*n+i] = 1.0;
+			orthogonal(Gb, size, n, state);
+		}
+	}
+
+	/* Shifts uniformly distributed in [-80,80], as the ones of the data file */
+	static void generateshifts(double *data, size_t numValues, size_t blockSize, int nx, uint64_t seed){
+		uint64_t state = seed;
+		for (size_t i=0; i<numValues; i++)
+			data[i] = -80.0+160.0*uniform(state);
+	}
+
+	/* Values read from the text file */
+	static void readtext(const std::string &textFile, double *data, size_t numValues){
+		std::ifstream fpt(textFile.c_str());
+		if (!fpt.is_open())
+		{
+			std::cerr<<std::endl<<"Error: Cannot open input file for reading"<<std::endl;
+			exit(-4);
+		}
+		for (size_t i=0; i<numValues; i++)
+			fpt>>data[i];
+		if (fpt.fail())
+		{
+			std::cerr<<std::endl<<"Error: The input file "<<textFile<<" has less than "<<numValues<<" values"<<std::endl;
+			exit(-4);
+		}
+		fpt.close();
+	}
+
+	/**
+	 * Function which returns the values of a data file
+	 * @param[in] textFile Name of the text file (not used if gen is not NULL)
+	 * @param[in] binFile Name of the binary file
+	 * @param[in] numValues Number of values to read from the file
+	 * @param[in] blockSize If it is not 0, the values are square blocks of blockSize x blockSize
+	 *                      values, and the transposed blocks are stored after them
+	 * @param[in] gen If it is not NULL, the values are generated by gen with the seed, instead of
+	 *                being read from the text file
+	 * @param[in] nx Dimension of the generated values
+	 * @param[in] seed Seed of the generated values
+	 * @return Pointer to the values (numValues, or 2*numValues if blockSize is not 0)
+	 */
+	static const double *load(const std::string &textFile, const std::string &binFile, size_t numValues, size_t blockSize,
+			Generator gen=NULL, int nx=0, uint64_t seed=0){
+		std::lock_guard<std::mutex> lock(registrymutex());
+		std::map<std::string, const double*>::iterator it = registry().find(binFile);
+		if (it != registry().end())
+			return it->second;
+
+		struct stat st;
+		bool hasText = gen == NULL && stat(textFile.c_str(), &st) == 0;
+		bool cache = caching();
+		FuncDataHeader h;
+		expectedheader(h, st, hasText, numValues, blockSize, seed);
+		const double *values = cache ? mapbinary(binFile, h, hasText) : NULL;
+
+		if (values == NULL)
+		{
+			size_t i,j,k,numDoubles = numValues * (blockSize > 0 ? 2 : 1);
+			double *data = new double[numDoubles];
+			if (gen != NULL)
+				gen(data, numValues, blockSize, nx, seed);
+			else
+				readtext(textFile, data, numValues);
+
+			//Transposed copy of every block, so that a column of a block is contiguous in memory
+			if (blockSize > 0)
+			{
+				size_t n = blockSize, block = n*n;
+				for (k=0; k<numValues/block; k++)
+					for (i=0; i<n; i++)
+						for (j=0; j<n; j++)
+							data[numValues+k*block+j*n+i] = data[k*block+i*n+j];
+			}
+
+			if (cache && writebinary(binFile, h, data, numDoubles) && (values = mapbinary(binFile, h, hasText)) != NULL)
+				delete[] data;
+			else
+				values = data;
+		}
+
+		registry()[binFile] = values;
+		return values;
+	}
+
+public:
+	/**
+	 * Function which tells whether a dimension has data files (the dimensions of CEC 2013). The
+	 * other dimensions use generated data.
+	 */
+	static bool hasfiles(int nx){
+		return nx==2||nx==5||nx==10||nx==20||nx==30||nx==40||nx==50||nx==60||nx==70||nx==80||nx==90||nx==100;
+	}
+
+	/**
+	 * Function which obtains the rotation matrices of a dimension
+	 * @param[in] nx Dimension
+	 * @param[in] cf_num Number of matrices
+	 * @param[out] M Matrices, by rows (cf_num blocks of nx x nx values)
+	 * @param[out] MT Transposed matrices
+	 */
+	static void matrices(int nx, int cf_num, const double *&M, const double *&MT){
+		char textFile[64], binFile[64];
+		sprintf(textFile, "input_data/M_D%d.txt", nx);
+		sprintf(binFile, "input_data/M_D%d.bin", nx);
+		M = load(textFile, binFile, (size_t) cf_num*nx*nx, nx);
+		MT = M + (size_t) cf_num*nx*nx;
+	}
+
+	/**
+	 * Function which obtains generated rotation matrices (for the dimensions without data files)
+	 * @param[in] nx Dimension
+	 * @param[in] cf_num Number of matrices
+	 * @param[in] seed Seed of the matrices
+	 * @param[out] M Matrices, by rows (cf_num blocks of nx x nx values)
+	 * @param[out] MT Transposed matrices
+	 */
+	static void generatedmatrices(int nx, int cf_num, uint64_t seed, const double *&M, const double *&MT){
+		char binFile[96];
+		snprintf(binFile, sizeof(binFile), "input_data/M_D%d_S%llu.bin", nx, (unsigned long long) seed);
+		M = load("", binFile, (size_t) cf_num*nx*nx, nx, generaterotations, nx, seed);
+		MT = M + (size_t) cf_num*nx*nx;
+	}
+
+	/**
+	 * Function which obtains generated shifts (for the dimensions without data files)
+	 * @param[in] nx Dimension
+	 * @param[in] cf_num Number of shifts
+	 * @param[in] seed Seed of the shifts
+	 * @return Shifts (cf_num vectors of nx values)
+	 */
+	static const double *generatedshifts(int nx, int cf_num, uint64_t seed){
+		char binFile[96];
+		snprintf(binFile, sizeof(binFile), "input_data/shift_D%d_S%llu.bin", nx, (unsigned long long) seed);
+		return load("", binFile, (size_t) cf_num*nx, 0, generateshifts, nx, seed);
+	}
+
+	/**
+	 * Function which obtains the matrices of grouped rotations: every matrix is made of the
+	 * orthogonal matrices of ceil(nx/groupSize) groups of groupSize variables (the last group may
+	 * have less), each one stored in a block of groupSize x groupSize values
+	 * @param[in] nx Dimension
+	 * @param[in] groupSize Size of the groups
+	 * @param[in] cf_num Number of matrices
+	 * @param[in] seed Seed of the matrices
+	 * @param[out] G Blocks of the groups, by rows (the groups of the first matrix, then the ones of the second...)
+	 * @param[out] GT Transposed blocks
+	 */
+	static void groupedmatrices(int nx, int groupSize, int cf_num, uint64_t seed, const double *&G, const double *&GT){
+		char binFile[96];
+		size_t numValues = (size_t) cf_num*((nx+groupSize-1)/groupSize)*groupSize*groupSize;
+		snprintf(binFile, sizeof(binFile), "input_data/G_D%d_K%d_S%llu.bin", nx, groupSize, (unsigned long long) seed);
+		G = load("", binFile, numValues, groupSize, generategroups, nx, seed);
+		GT = G + numValues;
+	}
+
+	/**
+	 * Function which obtains a random permutation of 0..nx-1 (Fisher-Yates)
+	 * @param[out] perm Permutation (nx values)
+	 * @param[in] nx Number of values
+	 * @param[in] seed Seed of the permutation
+	 */
+	static void permutation(int *perm, int nx, uint64_t seed){
+		uint64_t state = seed;
+		int i,j,t;
+		for (i=0; i<nx; i++)
+			perm[i] = i;
+		for (i=nx-1; i>0; i--)
+		{
+			j = (int) (nextrandom(state) % (uint64_t) (i+1));
+			t = perm[i];
+			perm[i] = perm[j];
+			perm[j] = t;
+		}
+	}
+
+	/**
+	 * Function which obtains a copy in single precision (rounded to the nearest float) of values
+	 * returned by this class. The copy is made in memory the first time, and it is shared by all
+	 * the instances of the process.
+	 * @param[in] values Values (matrices or shifts)
+	 * @param[in] numValues Number of values
+	 * @return Copy of the values
+	 */
+	static const float *singlecopy(const double *values, size_t numValues){
+		std::lock_guard<std::mutex> lock(registrymutex());
+		const float *&copy = floatregistry()[values];
+		if (copy == NULL)
+		{
+			float *data = new float[numValues];
+			for (size_t i=0; i<numValues; i++)
+				data[i] = (float) values[i];
+			copy = data;
+		}
+		return copy;
+	}
+
+	/**
+	 * Function which obtains the shifts of the optima
+	 * @param[in] nx Dimension
+	 * @param[in] cf_num Number of shifts
+	 * @return Shifts (the first cf_num*nx values of the file)
+	 */
+	static const double *shifts(int nx, int cf_num){
+		char binFile[64];
+		//Every dimension reads a different number of values, so each one has its binary file
+		sprintf(binFile, "input_data/shift_data_D%d.bin", nx);
+		return load("input_data/shift_data.txt", binFile, (size_t) cf_num*nx, 0);
+	}
+};
+
+#endif //P1_FUNCDATA_H
@@ -0,0 +1,981 @@
+/*
+ * FuncKernels.h
+ *
+ * File defining the vector kernels used by the test functions (shift, rotation, sums of squares
+ * sine, cosine, powers and the sums of the Katsuura function), with versions for several instruction sets
+ * selected at run time.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef P1_FUNCKERNELS_H
+#define P1_FUNCKERNELS_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <FuncMath.h>
+
+#define FUNC_BATCH 8 //Number of solutions rotated together by Func::fitnessBatch
+
+/**
+ * Class with pointers to the kernels of the best instruction set supported by the processor.
+ * The program is compiled for the base architecture, and the SSE2, AVX2 and AVX-512 versions
+ * are compiled with the target attribute, so a single binary can be run on any x86 machine.
+ * The choice can be forced with the environment variable FUNC_KERNELS (scalar, sse2, avx2 or
+ * avx512), which is useful for checking the results on a different machine.
+ *
+ * About the results:
+ * - shrink, rotate and axpy compute every element with the same operations and in the same order
+ *   as the original scalar loops, so they are bit-identical in all the versions. rotate uses the
+ *   transposed matrix, so it reads contiguous columns instead of contiguous rows. No version
+ *   fuses multiplications and additions.
+ * - rotatef, rotateblockf and axpyf read a copy of the matrices in single precision (see
+ *   Func::setPrecision), which halves the memory read by the rotations. Every value of the
+ *   matrix is converted to double (exactly), and the rest is computed as in the double versions,
+ *   so they are also the same in all the versions.
+ * - sumsq and distsq add the elements in 8 interleaved partial sums, which are combined in a
+ *   fixed order. The result differs from the sequential sum in the last bits, but it is the same
+ *   in all the versions, so a run can be reproduced on any machine.
+ * - cosine, sine, powconst and asy do not call the C library: they use the functions of FuncMath,
+ *   whose algorithms and error bounds are described there (1 ulp from the C library in most cases,
+ *   and a few ulp near the zeros of sin and cos). The results are the same in all the versions, and the
+ *   cosine does not slow down with large arguments as the C library does (the Weierstrass
+ *   function takes the cosine of values up to 1e11). The values which FuncMath does not compute
+ *   (arguments of sin and cos above 2^45, infinities, NaNs, powers of values which are not
+ *   positive, overflows and underflows) are given to the C library. powconst computes the
+ *   square roots (e=0.5) with the instruction sqrt, which is correctly rounded, and asy uses it
+ *   in the exponent, where the original code uses pow(x,0.5).
+ *   If the environment variable FUNC_MATH is libm, or the program is compiled with the macro
+ *   FUNC_STRICT_LIBM, these four kernels call the C library for every value, with the same
+ *   expressions as the original code, so the results of the reference implementation of the
+ *   test functions are reproduced exactly (except the reductions of sumsq and distsq).
+ *   Rotated Ackley (8) always uses these kernels (see getstrict and Func::Func).
+ * - katsuura computes the terms with the same operations as the original loop (2^j*y and the
+ *   division by 2^j are exact, so 2^-j is used as a factor, and both are obtained by doubling
+ *   and halving) and adds them in the
+ *   same order, so it is bit-identical in all the versions. The vector versions compute several
+ *   dimensions at the same time. SSE2 has no rounding instruction, so it uses the scalar one.
+ */
+class FuncKernels {
+public:
+	/**
+	 * Kernels:
+	 * shrink y[i]=((x[i]-Os[i])*a)/b
+	 * rotate xrot=M*x, given the transposed matrix MT (column j of M starts at MT[j*nx])
+	 * rotateblock Rotation of FUNC_BATCH vectors stored by rows (xb[j*FUNC_BATCH+s] is the element j of
+	 *             the vector s), given the matrix M by rows
+	 * axpy z[i]+=a*col[i]
+	 * rotatef, rotateblockf, axpyf The same, with the matrix in single precision (the products and
+	 *                              sums are computed in double precision)
+	 * sumsq Sum of x[i]*x[i]
+	 * distsq Sum of (x[i]-Os[i])*(x[i]-Os[i])
+	 * cosine y[i]=cos(x[i]) (x and y can be the same array)
+	 * sine y[i]=sin(x[i]) (x and y can be the same array)
+	 * powconst y[i]=pow(x[i],e) (x and y can be the same array)
+	 * asy xasy[i]=pow(x[i],1+beta*i/(nx-1)*sqrt(x[i])) for x[i]>0 (asymmetric transformation)
+	 * katsuura s[i]=Sum for j=1..32 of |2^j*y[i]-round(2^j*y[i])|/2^j
+	 * name Name of the instruction set of the kernels
+	 */
+	void (*shrink)(const double *x, const double *Os, double *y, int nx, double a, double b);
+	void (*rotate)(const double *x, double *xrot, int nx, const double *MT);
+	void (*rotateblock)(const double *xb, double *xrotb, int nx, const double *M);
+	void (*axpy)(double *z, double a, const double *col, int nx);
+	void (*rotatef)(const double *x, double *xrot, int nx, const float *MT);
+	void (*rotateblockf)(const double *xb, double *xrotb, int nx, const float *M);
+	void (*axpyf)(double *z, double a, const float *col, int nx);
+	double (*sumsq)(const double *x, int nx);
+	double (*distsq)(const double *x, const double *Os, int nx);
+	void (*cosine)(const double *x, double *y, int n);
+	void (*sine)(const double *x, double *y, int n);
+	void (*powconst)(const double *x, double *y, int n, double e);
+	void (*asy)(const double *x, double *xasy, int nx, double beta);
+	void (*katsuura)(const double *y, double *s, int nx);
+	const char *name;
+
+	/**
+	 * Function which returns the kernels for this processor. They are selected in the first call.
+	 */
+	static const FuncKernels &get(){
+		static const FuncKernels kernels=select();
+		return kernels;
+	}
+
+	/**
+	 * Function which returns the kernels for this processor with the C library in the elementary
+	 * functions, as with FUNC_MATH=libm, for the test functions whose results are too sensitive
+	 * to the rounding of cosine, sine, powconst and asy (see Func::Func)
+	 */
+	static const FuncKernels &getstrict(){
+		static const FuncKernels kernels=libmfunctions(select());
+		return kernels;
+	}
+
+private:
+	static FuncKernels select(){
+		FuncKernels k={scalar_shrink, scalar_rotate<double>, scalar_rotateblock<double>, scalar_axpy<double>, scalar_rotate<float>, scalar_rotateblock<float>, scalar_axpy<float>, scalar_sumsq, scalar_distsq, scalar_cosine, scalar_sine, scalar_powconst, scalar_asy, scalar_katsuura, "scalar"};
+		const char *forced=getenv("FUNC_KERNELS");
+		if (forced!=NULL && strcmp(forced, "scalar")==0)
+			return strictmath(k);
+#ifdef FUNC_KERNELS_X86
+		__builtin_cpu_init();
+		bool any=(forced==NULL);
+		if ((any || strcmp(forced, "sse2")==0 || strcmp(forced, "avx2")==0 || strcmp(forced, "avx512")==0)
+				&& __builtin_cpu_supports("sse2"))
+		{
+			FuncKernels s={sse2_shrink, sse2_rotate<double>, sse2_rotateblock<double>, sse2_axpy<double>, sse2_rotate<float>, sse2_rotateblock<float>, sse2_axpy<float>, sse2_sumsq, sse2_distsq, scalar_cosine, scalar_sine, scalar_powconst, scalar_asy, scalar_katsuura, "sse2"};
+			k=s;
+		}
+		if ((any || strcmp(forced, "avx2")==0 || strcmp(forced, "avx512")==0) && __builtin_cpu_supports("avx2"))
+		{
+			FuncKernels s={avx2_shrink, avx2_rotate<double>, avx2_rotateblock<double>, avx2_axpy<double>, avx2_rotate<float>, avx2_rotateblock<float>, avx2_axpy<float>, avx2_sumsq, avx2_distsq, avx2_cosine, avx2_sine, avx2_powconst, avx2_asy, avx2_katsuura, "avx2"};
+			if (!__builtin_cpu_supports("fma"))
+			{
+				s.cosine=scalar_cosine;
+				s.sine=scalar_sine;
+				s.powconst=scalar_powconst;
+				s.asy=scalar_asy;
+			}
+			k=s;
+		}
+		if ((any || strcmp(forced, "avx512")==0) && __builtin_cpu_supports("avx512f"))
+		{
+			FuncKernels s={avx512_shrink, avx512_rotate<double>, avx512_rotateblock<double>, avx512_axpy<double>, avx512_rotate<float>, avx512_rotateblock<float>, avx512_axpy<float>, avx512_sumsq, avx512_distsq, avx512_cosine, avx512_sine, avx512_powconst, avx512_asy, avx512_katsuura, "avx512"};
+			k=s;
+		}
+#endif
+		return strictmath(k);
+	}
+
+	/* Kernels k with the C library in the elementary functions, if it is requested */
+	static FuncKernels strictmath(FuncKernels k){
+#ifndef FUNC_STRICT_LIBM
+		const char *math=getenv("FUNC_MATH");
+		if (math==NULL || strcmp(math, "libm")!=0)
+			return k;
+#endif
+		return libmfunctions(k);
+	}
+
+	/* Kernels k with the C library in the elementary functions */
+	static FuncKernels libmfunctions(FuncKernels k){
+		k.cosine=libm_cosine;
+		k.sine=libm_sine;
+		k.powconst=libm_powconst;
+		k.asy=libm_asy;
+		return k;
+	}
+
+	/* Combination of the 8 partial sums, in the order used by every version */
+	static double combine(const double *s){
+		double t0=s[0]+s[4], t1=s[1]+s[5], t2=s[2]+s[6], t3=s[3]+s[7];
+		double u0=t0+t2, u1=t1+t3;
+		return u0+u1;
+	}
+
+	/* Cosine (sine if sine is true) of one value, with the C library for the values which FuncMath does not reduce */
+	static double trig1(double x, bool sine){
+		if (!(fabs(x)<=FuncMath::TRIG_LIMIT))
+			return sine ? sin(x) : cos(x);
+		return FuncMath::trig1(x, sine);
+	}
+
+	/* Power x^e, with the C library for the values which FuncMath does not compute */
+	static double pow1(double x, double e){
+		bool valid;
+		double y=FuncMath::pow1(x, e, valid);
+		return valid ? y : pow(x, e);
+	}
+
+	/* Exponent of the element i of the asymmetric transformation */
+	FUNC_NOCONTRACT
+	static double asyexp(double x, int i, int nx, double beta){
+		return 1.0+beta*i/(nx-1)*sqrt(x);
+	}
+
+	/* Number of terms of the sums of the Katsuura function */
+	enum { KATSUURA_TERMS=32 };
+
+	/* Term of the sum of the Katsuura function: |p*y-round(p*y)|*ip, with p=2^j and ip=2^-j */
+	FUNC_NOCONTRACT
+	static double katsuura1(double y, double p, double ip){
+		double t=p*y;
+		return fabs(t-floor(t+0.5))*ip;
+	}
+
+	/* Versions of the elementary functions with the C library (strict mode) */
+
+	static void libm_cosine(const double *x, double *y, int n){
+		for (int i=0; i<n; i++)
+			y[i]=cos(x[i]);
+	}
+
+	static void libm_sine(const double *x, double *y, int n){
+		for (int i=0; i<n; i++)
+			y[i]=sin(x[i]);
+	}
+
+	static void libm_powconst(const double *x, double *y, int n, double e){
+		for (int i=0; i<n; i++)
+			y[i]=pow(x[i], e);
+	}
+
+	FUNC_NOCONTRACT
+	static void libm_asy(const double *x, double *xasy, int nx, double beta){
+		for (int i=0; i<nx; i++)
+			if (x[i]>0)
+				xasy[i]=pow(x[i],1.0+beta*i/(nx-1)*pow(x[i],0.5));
+	}
+
+	/* Scalar versions */
+
+	static void scalar_shrink(const double *x, const double *Os, double *y, int nx, double a, double b){
+		for (int i=0; i<nx; i++)
+			y[i]=(x[i]-Os[i])*a/b;
+	}
+
+	template<typename T>
+	static void scalar_rotate(const double *x, double *xrot, int nx, const T *MT){
+		int i,j;
+		for (i=0; i<nx; i++)
+			xrot[i]=0;
+		for (j=0; j<nx; j++)
+			for (i=0; i<nx; i++)
+				xrot[i]=xrot[i]+x[j]*MT[j*nx+i];
+	}
+
+	template<typename T>
+	static void scalar_rotateblock(const double *xb, double *xrotb, int nx, const T *M){
+		int i,j,s;
+		for (i=0; i<nx; i++)
+		{
+			double xrot[FUNC_BATCH];
+			for (s=0; s<FUNC_BATCH; s++)
+				xrot[s]=0;
+			for (j=0; j<nx; j++)
+			{
+				double m=M[i*nx+j];
+				for (s=0; s<FUNC_BATCH; s++)
+					xrot[s]=xrot[s]+xb[j*FUNC_BATCH+s]*m;
+			}
+			for (s=0; s<FUNC_BATCH; s++)
+				xrotb[i*FUNC_BATCH+s]=xrot[s];
+		}
+	}
+
+	template<typename T>
+	static void scalar_axpy(double *z, double a, const T *col, int nx){
+		for (int i=0; i<nx; i++)
+			z[i]+=a*col[i];
+	}
+
+	static double scalar_sumsq(const double *x, int nx){
+		double s[8]={0,0,0,0,0,0,0,0};
+		int i,k,n8=nx-nx%8;
+		for (i=0; i<n8; i+=8)
+			for (k=0; k<8; k++)
+				s[k]+=x[i+k]*x[i+k];
+		double r=combine(s);
+		for (; i<nx; i++)
+			r+=x[i]*x[i];
+		return r;
+	}
+
+	static double scalar_distsq(const double *x, const double *Os, int nx){
+		double s[8]={0,0,0,0,0,0,0,0},d;
+		int i,k,n8=nx-nx%8;
+		for (i=0; i<n8; i+=8)
+			for (k=0; k<8; k++)
+			{
+				d=x[i+k]-Os[i+k];
+				s[k]+=d*d;
+			}
+		double r=combine(s);
+		for (; i<nx; i++)
+		{
+			d=x[i]-Os[i];
+			r+=d*d;
+		}
+		return r;
+	}
+
+	static void scalar_cosine(const double *x, double *y, int n){
+		for (int i=0; i<n; i++)
+			y[i]=trig1(x[i], false);
+	}
+
+	static void scalar_sine(const double *x, double *y, int n){
+		for (int i=0; i<n; i++)
+			y[i]=trig1(x[i], true);
+	}
+
+	static void scalar_powconst(const double *x, double *y, int n, double e){
+		if (e==0.5)
+			for (int i=0; i<n; i++)
+				y[i]=sqrt(x[i]);
+		else
+			for (int i=0; i<n; i++)
+				y[i]=pow1(x[i], e);
+	}
+
+	static void scalar_asy(const double *x, double *xasy, int nx, double beta){
+		for (int i=0; i<nx; i++)
+			if (x[i]>0)
+				xasy[i]=pow1(x[i], asyexp(x[i], i, nx, beta));
+	}
+
+	static void scalar_katsuura(const double *y, double *s, int nx){
+		for (int i=0; i<nx; i++)
+		{
+			double sum=0.0, p=1.0, ip=1.0;
+			for (int j=1; j<=KATSUURA_TERMS; j++)
+			{
+				p*=2.0;
+				ip*=0.5;
+				sum+=katsuura1(y[i], p, ip);
+			}
+			s[i]=sum;
+		}
+	}
+
+#ifdef FUNC_KERNELS_X86
+	/* SSE2 versions (2 doubles per register). SSE2 has no fma, so the elementary functions are the scalar ones */
+
+	FUNC_KERNEL("sse2")
+	static void sse2_shrink(const double *x, const double *Os, double *y, int nx, double a, double b){
+		int i=0;
+		__m128d va=_mm_set1_pd(a), vb=_mm_set1_pd(b);
+		for (; i+2<=nx; i+=2)
+			_mm_storeu_pd(&y[i], _mm_div_pd(_mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(&x[i]), _mm_loadu_pd(&Os[i])), va), vb));
+		for (; i<nx; i++)
+			y[i]=(x[i]-Os[i])*a/b;
+	}
+
+	/* Loads of 2 values of a matrix, converted to double */
+	FUNC_KERNEL("sse2")
+	static __m128d sse2_load(const double *p){
+		return _mm_loadu_pd(p);
+	}
+
+	FUNC_KERNEL("sse2")
+	static __m128d sse2_load(const float *p){
+		return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*) p)));
+	}
+
+	template<typename T>
+	FUNC_KERNEL("sse2")
+	static void sse2_rotate(const double *x, double *xrot, int nx, const T *MT){
+		int i=0,j;
+		for (; i+8<=nx; i+=8)
+		{
+			__m128d r0=_mm_setzero_pd(), r1=_mm_setzero_pd(), r2=_mm_setzero_pd(), r3=_mm_setzero_pd();
+			for (j=0; j<nx; j++)
+			{
+				const T *col=&MT[j*nx+i];
+				__m128d xj=_mm_set1_pd(x[j]);
+				r0=_mm_add_pd(r0, _mm_mul_pd(xj, sse2_load(&col[0])));
+				r1=_mm_add_pd(r1, _mm_mul_pd(xj, sse2_load(&col[2])));
+				r2=_mm_add_pd(r2, _mm_mul_pd(xj, sse2_load(&col[4])));
+				r3=_mm_add_pd(r3, _mm_mul_pd(xj, sse2_load(&col[6])));
+			}
+			_mm_storeu_pd(&xrot[i], r0);
+			_mm_storeu_pd(&xrot[i+2], r1);
+			_mm_storeu_pd(&xrot[i+4], r2);
+			_mm_storeu_pd(&xrot[i+6], r3);
+		}
+		for (; i+2<=nx; i+=2)
+		{
+			__m128d r=_mm_setzero_pd();
+			for (j=0; j<nx; j++)
+				r=_mm_add_pd(r, _mm_mul_pd(_mm_set1_pd(x[j]), sse2_load(&MT[j*nx+i])));
+			_mm_storeu_pd(&xrot[i], r);
+		}
+		for (; i<nx; i++)
+		{
+			xrot[i]=0;
+			for (j=0; j<nx; j++)
+				xrot[i]=xrot[i]+x[j]*MT[j*nx+i];
+		}
+	}
+
+	template<typename T>
+	FUNC_KERNEL("sse2")
+	static void sse2_rotateblock(const double *xb, double *xrotb, int nx, const T *M){
+		for (int i=0; i<nx; i++)
+		{
+			__m128d r0=_mm_setzero_pd(), r1=_mm_setzero_pd(), r2=_mm_setzero_pd(), r3=_mm_setzero_pd();
+			for (int j=0; j<nx; j++)
+			{
+				const double *xj=&xb[j*FUNC_BATCH];
+				__m128d m=_mm_set1_pd(M[i*nx+j]);
+				r0=_mm_add_pd(r0, _mm_mul_pd(_mm_loadu_pd(&xj[0]), m));
+				r1=_mm_add_pd(r1, _mm_mul_pd(_mm_loadu_pd(&xj[2]), m));
+				r2=_mm_add_pd(r2, _mm_mul_pd(_mm_loadu_pd(&xj[4]), m));
+				r3=_mm_add_pd(r3, _mm_mul_pd(_mm_loadu_pd(&xj[6]), m));
+			}
+			_mm_storeu_pd(&xrotb[i*FUNC_BATCH], r0);
+			_mm_storeu_pd(&xrotb[i*FUNC_BATCH+2], r1);
+			_mm_storeu_pd(&xrotb[i*FUNC_BATCH+4], r2);
+			_mm_storeu_pd(&xrotb[i*FUNC_BATCH+6], r3);
+		}
+	}
+
+	template<typename T>
+	FUNC_KERNEL("sse2")
+	static void sse2_axpy(double *z, double a, const T *col, int nx){
+		int i=0;
+		__m128d va=_mm_set1_pd(a);
+		for (; i+2<=nx; i+=2)
+			_mm_storeu_pd(&z[i], _mm_add_pd(_mm_loadu_pd(&z[i]), _mm_mul_pd(va, sse2_load(&col[i]))));
+		for (; i<nx; i++)
+			z[i]+=a*col[i];
+	}
+
+	FUNC_KERNEL("sse2")
+	static double sse2_sumsq(const double *x, int nx){
+		__m128d s0=_mm_setzero_pd(), s1=_mm_setzero_pd(), s2=_mm_setzero_pd(), s3=_mm_setzero_pd(), v;
+		int i=0;
+		for (; i+8<=nx; i+=8)
+		{
+			v=_mm_loadu_pd(&x[i]);
+			s0=_mm_add_pd(s0, _mm_mul_pd(v, v));
+			v=_mm_loadu_pd(&x[i+2]);
+			s1=_mm_add_pd(s1, _mm_mul_pd(v, v));
+			v=_mm_loadu_pd(&x[i+4]);
+			s2=_mm_add_pd(s2, _mm_mul_pd(v, v));
+			v=_mm_loadu_pd(&x[i+6]);
+			s3=_mm_add_pd(s3, _mm_mul_pd(v, v));
+		}
+		double s[8];
+		_mm_storeu_pd(&s[0], s0);
+		_mm_storeu_pd(&s[2], s1);
+		_mm_storeu_pd(&s[4], s2);
+		_mm_storeu_pd(&s[6], s3);
+		double r=combine(s);
+		for (; i<nx; i++)
+			r+=x[i]*x[i];
+		return r;
+	}
+
+	FUNC_KERNEL("sse2")
+	static double sse2_distsq(const double *x, const double *Os, int nx){
+		__m128d s0=_mm_setzero_pd(), s1=_mm_setzero_pd(), s2=_mm_setzero_pd(), s3=_mm_setzero_pd(), v;
+		int i=0;
+		double d;
+		for (; i+8<=nx; i+=8)
+		{
+			v=_mm_sub_pd(_mm_loadu_pd(&x[i]), _mm_loadu_pd(&Os[i]));
+			s0=_mm_add_pd(s0, _mm_mul_pd(v, v));
+			v=_mm_sub_pd(_mm_loadu_pd(&x[i+2]), _mm_loadu_pd(&Os[i+2]));
+			s1=_mm_add_pd(s1, _mm_mul_pd(v, v));
+			v=_mm_sub_pd(_mm_loadu_pd(&x[i+4]), _mm_loadu_pd(&Os[i+4]));
+			s2=_mm_add_pd(s2, _mm_mul_pd(v, v));
+			v=_mm_sub_pd(_mm_loadu_pd(&x[i+6]), _mm_loadu_pd(&Os[i+6]));
+			s3=_mm_add_pd(s3, _mm_mul_pd(v, v));
+		}
+		double s[8];
+		_mm_storeu_pd(&s[0], s0);
+		_mm_storeu_pd(&s[2], s1);
+		_mm_storeu_pd(&s[4], s2);
+		_mm_storeu_pd(&s[6], s3);
+		double r=combine(s);
+		for (; i<nx; i++)
+		{
+			d=x[i]-Os[i];
+			r+=d*d;
+		}
+		return r;
+	}
+
+	/* AVX2 versions (4 doubles per register) */
+
+	FUNC_KERNEL("avx2")
+	static void avx2_shrink(const double *x, const double *Os, double *y, int nx, double a, double b){
+		int i=0;
+		__m256d va=_mm256_set1_pd(a), vb=_mm256_set1_pd(b);
+		for (; i+4<=nx; i+=4)
+			_mm256_storeu_pd(&y[i], _mm256_div_pd(_mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(&x[i]),
+					_mm256_loadu_pd(&Os[i])), va), vb));
+		for (; i<nx; i++)
+			y[i]=(x[i]-Os[i])*a/b;
+	}
+
+	/* Loads of 4 values of a matrix, converted to double */
+	FUNC_KERNEL("avx2")
+	static __m256d avx2_load(const double *p){
+		return _mm256_loadu_pd(p);
+	}
+
+	FUNC_KERNEL("avx2")
+	static __m256d avx2_load(const float *p){
+		return _mm256_cvtps_pd(_mm_loadu_ps(p));
+	}
+
+	template<typename T>
+	FUNC_KERNEL("avx2")
+	static void avx2_rotate(const double *x, double *xrot, int nx, const T *MT){
+		int i=0,j;
+		for (; i+16<=nx; i+=16)
+		{
+			__m256d r0=_mm256_setzero_pd(), r1=_mm256_setzero_pd(), r2=_mm256_setzero_pd(), r3=_mm256_setzero_pd();
+			for (j=0; j<nx; j++)
+			{
+				const T *col=&MT[j*nx+i];
+				__m256d xj=_mm256_set1_pd(x[j]);
+				r0=_mm256_add_pd(r0, _mm256_mul_pd(xj, avx2_load(&col[0])));
+				r1=_mm256_add_pd(r1, _mm256_mul_pd(xj, avx2_load(&col[4])));
+				r2=_mm256_add_pd(r2, _mm256_mul_pd(xj, avx2_load(&col[8])));
+				r3=_mm256_add_pd(r3, _mm256_mul_pd(xj, avx2_load(&col[12])));
+			}
+			_mm256_storeu_pd(&xrot[i], r0);
+			_mm256_storeu_pd(&xrot[i+4], r1);
+			_mm256_storeu_pd(&xrot[i+8], r2);
+			_mm256_storeu_pd(&xrot[i+12], r3);
+		}
+		for (; i+4<=nx; i+=4)
+		{
+			__m256d r=_mm256_setzero_pd();
+			for (j=0; j<nx; j++)
+				r=_mm256_add_pd(r, _mm256_mul_pd(_mm256_set1_pd(x[j]), avx2_load(&MT[j*nx+i])));
+			_mm256_storeu_pd(&xrot[i], r);
+		}
+		for (; i<nx; i++)
+		{
+			xrot[i]=0;
+			for (j=0; j<nx; j++)
+				xrot[i]=xrot[i]+x[j]*MT[j*nx+i];
+		}
+	}
+
+	template<typename T>
+	FUNC_KERNEL("avx2")
+	static void avx2_rotateblock(const double *xb, double *xrotb, int nx, const T *M){
+		for (int i=0; i<nx; i++)
+		{
+			__m256d r0=_mm256_setzero_pd(), r1=_mm256_setzero_pd();
+			for (int j=0; j<nx; j++)
+			{
+				const double *xj=&xb[j*FUNC_BATCH];
+				__m256d m=_mm256_set1_pd(M[i*nx+j]);
+				r0=_mm256_add_pd(r0, _mm256_mul_pd(_mm256_loadu_pd(&xj[0]), m));
+				r1=_mm256_add_pd(r1, _mm256_mul_pd(_mm256_loadu_pd(&xj[4]), m));
+			}
+			_mm256_storeu_pd(&xrotb[i*FUNC_BATCH], r0);
+			_mm256_storeu_pd(&xrotb[i*FUNC_BATCH+4], r1);
+		}
+	}
+
+	template<typename T>
+	FUNC_KERNEL("avx2")
+	static void avx2_axpy(double *z, double a, const T *col, int nx){
+		int i=0;
+		__m256d va=_mm256_set1_pd(a);
+		for (; i+4<=nx; i+=4)
+			_mm256_storeu_pd(&z[i], _mm256_add_pd(_mm256_loadu_pd(&z[i]), _mm256_mul_pd(va, avx2_load(&col[i]))));
+		for (; i<nx; i++)
+			z[i]+=a*col[i];
+	}
+
+	FUNC_KERNEL("avx2")
+	static double avx2_sumsq(const double *x, int nx){
+		__m256d s0=_mm256_setzero_pd(), s1=_mm256_setzero_pd(), v;
+		int i=0;
+		for (; i+8<=nx; i+=8)
+		{
+			v=_mm256_loadu_pd(&x[i]);
+			s0=_mm256_add_pd(s0, _mm256_mul_pd(v, v));
+			v=_mm256_loadu_pd(&x[i+4]);
+			s1=_mm256_add_pd(s1, _mm256_mul_pd(v, v));
+		}
+		double s[8];
+		_mm256_storeu_pd(&s[0], s0);
+		_mm256_storeu_pd(&s[4], s1);
+		double r=combine(s);
+		for (; i<nx; i++)
+			r+=x[i]*x[i];
+		return r;
+	}
+
+	FUNC_KERNEL("avx2")
+	static double avx2_distsq(const double *x, const double *Os, int nx){
+		__m256d s0=_mm256_setzero_pd(), s1=_mm256_setzero_pd(), v;
+		int i=0;
+		double d;
+		for (; i+8<=nx; i+=8)
+		{
+			v=_mm256_sub_pd(_mm256_loadu_pd(&x[i]), _mm256_loadu_pd(&Os[i]));
+			s0=_mm256_add_pd(s0, _mm256_mul_pd(v, v));
+			v=_mm256_sub_pd(_mm256_loadu_pd(&x[i+4]), _mm256_loadu_pd(&Os[i+4]));
+			s1=_mm256_add_pd(s1, _mm256_mul_pd(v, v));
+		}
+		double s[8];
+		_mm256_storeu_pd(&s[0], s0);
+		_mm256_storeu_pd(&s[4], s1);
+		double r=combine(s);
+		for (; i<nx; i++)
+		{
+			d=x[i]-Os[i];
+			r+=d*d;
+		}
+		return r;
+	}
+
+	/* Cosine (sine if sine is true) of 4 values at a time. x and y can be the same array */
+	FUNC_KERNEL("avx2,fma")
+	static void avx2_trig(const double *x, double *y, int n, bool sine){
+		int i=0,k;
+		__m256d limit=_mm256_set1_pd(FuncMath::TRIG_LIMIT), sign=_mm256_set1_pd(-0.0);
+		for (; i+4<=n; i+=4)
+		{
+			__m256d v=_mm256_loadu_pd(&x[i]), r=FuncMath::trig4(v, sine);
+			//Values which are not reduced (the comparison is false with NaN)
+			int reduced=_mm256_movemask_pd(_mm256_cmp_pd(_mm256_andnot_pd(sign, v), limit, _CMP_LE_OQ));
+			_mm256_storeu_pd(&y[i], r);
+			if (reduced!=0xF)
+				for (k=0; k<4; k++)
+					if (!((reduced>>k)&1))
+						y[i+k]=sine ? sin(v[k]) : cos(v[k]);
+		}
+		for (; i<n; i++)
+			y[i]=trig1(x[i], sine);
+	}
+
+	FUNC_KERNEL("avx2,fma")
+	static void avx2_cosine(const double *x, double *y, int n){
+		avx2_trig(x, y, n, false);
+	}
+
+	FUNC_KERNEL("avx2,fma")
+	static void avx2_sine(const double *x, double *y, int n){
+		avx2_trig(x, y, n, true);
+	}
+
+	FUNC_KERNEL("avx2,fma")
+	static void avx2_powconst(const double *x, double *y, int n, double e){
+		int i=0,k,valid;
+		__m256d ev=_mm256_set1_pd(e);
+		if (e==0.5)
+		{
+			for (; i+4<=n; i+=4)
+				_mm256_storeu_pd(&y[i], _mm256_sqrt_pd(_mm256_loadu_pd(&x[i])));
+			for (; i<n; i++)
+				y[i]=sqrt(x[i]);
+			return;
+		}
+		for (; i+4<=n; i+=4)
+		{
+			__m256d v=_mm256_loadu_pd(&x[i]), r=FuncMath::pow4(v, ev, valid);
+			_mm256_storeu_pd(&y[i], r);
+			if (valid!=0xF)
+				for (k=0; k<4; k++)
+					if (!((valid>>k)&1))
+						y[i+k]=pow(v[k], e);
+		}
+		for (; i<n; i++)
+			y[i]=pow1(x[i], e);
+	}
+
+	FUNC_KERNEL("avx2,fma")
+	static void avx2_asy(const double *x, double *xasy, int nx, double beta){
+		int i=0,k,valid;
+		__m256d one=_mm256_set1_pd(1.0), b=_mm256_set1_pd(beta), d=_mm256_set1_pd(nx-1);
+		__m256d idx=_mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+		for (; i+4<=nx; i+=4, idx=_mm256_add_pd(idx, _mm256_set1_pd(4.0)))
+		{
+			__m256d v=_mm256_loadu_pd(&x[i]), pos=_mm256_cmp_pd(v, _mm256_setzero_pd(), _CMP_GT_OQ);
+			int positive=_mm256_movemask_pd(pos);
+			if (positive==0)
+				continue;
+			//Operations of asyexp
+			__m256d e=_mm256_add_pd(one, _mm256_mul_pd(_mm256_div_pd(_mm256_mul_pd(b, idx), d), _mm256_sqrt_pd(v)));
+			__m256d r=FuncMath::pow4(v, e, valid);
+			_mm256_storeu_pd(&xasy[i], _mm256_blendv_pd(_mm256_loadu_pd(&xasy[i]), r, pos));
+			if ((positive&valid)!=positive)
+				for (k=0; k<4; k++)
+					if (((positive&~valid)>>k)&1)
+						xasy[i+k]=pow(v[k], e[k]);
+		}
+		for (; i<nx; i++)
+			if (x[i]>0)
+				xasy[i]=pow1(x[i], asyexp(x[i], i, nx, beta));
+	}
+
+	FUNC_KERNEL("avx2")
+	static void avx2_katsuura(const double *y, double *s, int nx){
+		int i=0;
+		__m256d half=_mm256_set1_pd(0.5), sign=_mm256_set1_pd(-0.0);
+		for (; i+4<=nx; i+=4)
+		{
+			__m256d v=_mm256_loadu_pd(&y[i]), sum=_mm256_setzero_pd();
+			__m256d p=_mm256_set1_pd(1.0), ip=_mm256_set1_pd(1.0);
+			for (int j=1; j<=KATSUURA_TERMS; j++)
+			{
+				p=_mm256_add_pd(p, p);
+				ip=_mm256_mul_pd(ip, half);
+				__m256d t=_mm256_mul_pd(v, p);
+				__m256d d=_mm256_andnot_pd(sign, _mm256_sub_pd(t, _mm256_floor_pd(_mm256_add_pd(t, half))));
+				sum=_mm256_add_pd(sum, _mm256_mul_pd(d, ip));
+			}
+			_mm256_storeu_pd(&s[i], sum);
+		}
+		for (; i<nx; i++)
+		{
+			double sum=0.0, p=1.0, ip=1.0;
+			for (int j=1; j<=KATSUURA_TERMS; j++)
+			{
+				p*=2.0;
+				ip*=0.5;
+				sum+=katsuura1(y[i], p, ip);
+			}
+			s[i]=sum;
+		}
+	}
+
+	/* AVX-512 versions (8 doubles per register) */
+
+	FUNC_KERNEL("avx512f")
+	static void avx512_shrink(const double *x, const double *Os, double *y, int nx, double a, double b){
+		int i=0;
+		__m512d va=_mm512_set1_pd(a), vb=_mm512_set1_pd(b);
+		for (; i+8<=nx; i+=8)
+			_mm512_storeu_pd(&y[i], _mm512_div_pd(_mm512_mul_pd(_mm512_sub_pd(_mm512_loadu_pd(&x[i]),
+					_mm512_loadu_pd(&Os[i])), va), vb));
+		for (; i<nx; i++)
+			y[i]=(x[i]-Os[i])*a/b;
+	}
+
+	/* Loads of 8 values of a matrix (or of the first ones, given by the mask m), converted to double */
+	FUNC_KERNEL("avx512f")
+	static __m512d avx512_load(const double *p){
+		return _mm512_loadu_pd(p);
+	}
+
+	FUNC_KERNEL("avx512f")
+	static __m512d avx512_load(const float *p){
+		return _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(p));
+	}
+
+	FUNC_KERNEL("avx512f")
+	static __m512d avx512_load(__mmask8 m, const double *p){
+		return _mm512_maskz_loadu_pd(m, p);
+	}
+
+	FUNC_KERNEL("avx512f")
+	static __m512d avx512_load(__mmask8 m, const float *p){
+		__m256i lanes=_mm256_cmpgt_epi32(_mm256_set1_epi32(__builtin_popcount(m)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+		return _mm512_maskz_cvtps_pd(0xFF, _mm256_maskload_ps(p, lanes));
+	}
+
+	template<typename T>
+	FUNC_KERNEL("avx512f")
+	static void avx512_rotate(const double *x, double *xrot, int nx, const T *MT){
+		int i=0,j;
+		for (; i+32<=nx; i+=32)
+		{
+			__m512d r0=_mm512_setzero_pd(), r1=_mm512_setzero_pd(), r2=_mm512_setzero_pd(), r3=_mm512_setzero_pd();
+			for (j=0; j<nx; j++)
+			{
+				const T *col=&MT[j*nx+i];
+				__m512d xj=_mm512_set1_pd(x[j]);
+				r0=_mm512_add_pd(r0, _mm512_mul_pd(xj, avx512_load(&col[0])));
+				r1=_mm512_add_pd(r1, _mm512_mul_pd(xj, avx512_load(&col[8])));
+				r2=_mm512_add_pd(r2, _mm512_mul_pd(xj, avx512_load(&col[16])));
+				r3=_mm512_add_pd(r3, _mm512_mul_pd(xj, avx512_load(&col[24])));
+			}
+			_mm512_storeu_pd(&xrot[i], r0);
+			_mm512_storeu_pd(&xrot[i+8], r1);
+			_mm512_storeu_pd(&xrot[i+16], r2);
+			_mm512_storeu_pd(&xrot[i+24], r3);
+		}
+		for (; i+8<=nx; i+=8)
+		{
+			__m512d r=_mm512_setzero_pd();
+			for (j=0; j<nx; j++)
+				r=_mm512_add_pd(r, _mm512_mul_pd(_mm512_set1_pd(x[j]), avx512_load(&MT[j*nx+i])));
+			_mm512_storeu_pd(&xrot[i], r);
+		}
+		if (i<nx)
+		{
+			__mmask8 m=(__mmask8)((1u<<(nx-i))-1);
+			__m512d r=_mm512_setzero_pd();
+			for (j=0; j<nx; j++)
+				r=_mm512_add_pd(r, _mm512_mul_pd(_mm512_set1_pd(x[j]), avx512_load(m, &MT[j*nx+i])));
+			_mm512_mask_storeu_pd(&xrot[i], m, r);
+		}
+	}
+
+	template<typename T>
+	FUNC_KERNEL("avx512f")
+	static void avx512_rotateblock(const double *xb, double *xrotb, int nx, const T *M){
+		for (int i=0; i<nx; i++)
+		{
+			__m512d r=_mm512_setzero_pd();
+			for (int j=0; j<nx; j++)
+				r=_mm512_add_pd(r, _mm512_mul_pd(_mm512_loadu_pd(&xb[j*FUNC_BATCH]), _mm512_set1_pd(M[i*nx+j])));
+			_mm512_storeu_pd(&xrotb[i*FUNC_BATCH], r);
+		}
+	}
+
+	template<typename T>
+	FUNC_KERNEL("avx512f")
+	static void avx512_axpy(double *z, double a, const T *col, int nx){
+		int i=0;
+		__m512d va=_mm512_set1_pd(a);
+		for (; i+8<=nx; i+=8)
+			_mm512_storeu_pd(&z[i], _mm512_add_pd(_mm512_loadu_pd(&z[i]), _mm512_mul_pd(va, avx512_load(&col[i]))));
+		if (i<nx)
+		{
+			__mmask8 m=(__mmask8)((1u<<(nx-i))-1);
+			_mm512_mask_storeu_pd(&z[i], m, _mm512_add_pd(_mm512_maskz_loadu_pd(m, &z[i]),
+					_mm512_mul_pd(va, avx512_load(m, &col[i]))));
+		}
+	}
+
+	FUNC_KERNEL("avx512f")
+	static double avx512_sumsq(const double *x, int nx){
+		__m512d s0=_mm512_setzero_pd(), v;
+		int i=0;
+		for (; i+8<=nx; i+=8)
+		{
+			v=_mm512_loadu_pd(&x[i]);
+			s0=_mm512_add_pd(s0, _mm512_mul_pd(v, v));
+		}
+		double s[8];
+		_mm512_storeu_pd(s, s0);
+		double r=combine(s);
+		for (; i<nx; i++)
+			r+=x[i]*x[i];
+		return r;
+	}
+
+	FUNC_KERNEL("avx512f")
+	static double avx512_distsq(const double *x, const double *Os, int nx){
+		__m512d s0=_mm512_setzero_pd(), v;
+		int i=0;
+		double d;
+		for (; i+8<=nx; i+=8)
+		{
+			v=_mm512_sub_pd(_mm512_loadu_pd(&x[i]), _mm512_loadu_pd(&Os[i]));
+			s0=_mm512_add_pd(s0, _mm512_mul_pd(v, v));
+		}
+		double s[8];
+		_mm512_storeu_pd(s, s0);
+		double r=combine(s);
+		for (; i<nx; i++)
+		{
+			d=x[i]-Os[i];
+			r+=d*d;
+		}
+		return r;
+	}
+
+	FUNC_KERNEL("avx512f")
+	static void avx512_katsuura(const double *y, double *s, int nx){
+		int i=0;
+		__m512d half=_mm512_set1_pd(0.5);
+		__m512i nosign=_mm512_set1_epi64(0x7FFFFFFFFFFFFFFFLL);
+		for (; i<nx; i+=8)
+		{
+			__mmask8 m=(nx-i>=8) ? 0xFF : (__mmask8)((1u<<(nx-i))-1);
+			__m512d v=_mm512_maskz_loadu_pd(m, &y[i]), sum=_mm512_setzero_pd();
+			__m512d p=_mm512_set1_pd(1.0), ip=_mm512_set1_pd(1.0);
+			for (int j=1; j<=KATSUURA_TERMS; j++)
+			{
+				p=_mm512_add_pd(p, p);
+				ip=_mm512_mul_pd(ip, half);
+				__m512d t=_mm512_mul_pd(v, p);
+				__m512d d=_mm512_sub_pd(t, _mm512_maskz_roundscale_pd(0xFF, _mm512_add_pd(t, half), _MM_FROUND_TO_NEG_INF|_MM_FROUND_NO_EXC));
+				d=_mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(d), nosign));
+				sum=_mm512_add_pd(sum, _mm512_mul_pd(d, ip));
+			}
+			_mm512_mask_storeu_pd(&s[i], m, sum);
+		}
+	}
+
+	/* Cosine (sine if sine is true) of 8 values at a time. x and y can be the same array */
+	FUNC_KERNEL("avx512f")
+	static void avx512_trig(const double *x, double *y, int n, bool sine){
+		int i=0,k;
+		__m512d limit=_mm512_set1_pd(FuncMath::TRIG_LIMIT);
+		__m512i nosign=_mm512_set1_epi64(0x7FFFFFFFFFFFFFFFLL);
+		for (; i+8<=n; i+=8)
+		{
+			__m512d v=_mm512_loadu_pd(&x[i]), r=FuncMath::trig8(v, sine);
+			//Values which are not reduced (the comparison is false with NaN)
+			__mmask8 reduced=_mm512_cmp_pd_mask(_mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(v), nosign)), limit, _CMP_LE_OQ);
+			_mm512_storeu_pd(&y[i], r);
+			if (reduced!=0xFF)
+				for (k=0; k<8; k++)
+					if (!((reduced>>k)&1))
+						y[i+k]=sine ? sin(v[k]) : cos(v[k]);
+		}
+		for (; i<n; i++)
+			y[i]=trig1(x[i], sine);
+	}
+
+	FUNC_KERNEL("avx512f")
+	static void avx512_cosine(const double *x, double *y, int n){
+		avx512_trig(x, y, n, false);
+	}
+
+	FUNC_KERNEL("avx512f")
+	static void avx512_sine(const double *x, double *y, int n){
+		avx512_trig(x, y, n, true);
+	}
+
+	FUNC_KERNEL("avx512f")
+	static void avx512_powconst(const double *x, double *y, int n, double e){
+		int i=0,k;
+		__mmask8 valid;
+		__m512d ev=_mm512_set1_pd(e);
+		if (e==0.5)
+		{
+			for (; i+8<=n; i+=8)
+				_mm512_storeu_pd(&y[i], _mm512_maskz_sqrt_pd(0xFF, _mm512_loadu_pd(&x[i])));
+			for (; i<n; i++)
+				y[i]=sqrt(x[i]);
+			return;
+		}
+		for (; i+8<=n; i+=8)
+		{
+			__m512d v=_mm512_loadu_pd(&x[i]), r=FuncMath::pow8(v, ev, valid);
+			_mm512_storeu_pd(&y[i], r);
+			if (valid!=0xFF)
+				for (k=0; k<8; k++)
+					if (!((valid>>k)&1))
+						y[i+k]=pow(v[k], e);
+		}
+		for (; i<n; i++)
+			y[i]=pow1(x[i], e);
+	}
+
+	FUNC_KERNEL("avx512f")
+	static void avx512_asy(const double *x, double *xasy, int nx, double beta){
+		int i=0,k;
+		__mmask8 valid;
+		__m512d one=_mm512_set1_pd(1.0), b=_mm512_set1_pd(beta), d=_mm512_set1_pd(nx-1);
+		__m512d idx=_mm512_set_pd(7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0);
+		for (; i+8<=nx; i+=8, idx=_mm512_add_pd(idx, _mm512_set1_pd(8.0)))
+		{
+			__m512d v=_mm512_loadu_pd(&x[i]);
+			__mmask8 positive=_mm512_cmp_pd_mask(v, _mm512_setzero_pd(), _CMP_GT_OQ);
+			if (positive==0)
+				continue;
+			//Operations of asyexp
+			__m512d e=_mm512_add_pd(one, _mm512_mul_pd(_mm512_div_pd(_mm512_mul_pd(b, idx), d), _mm512_maskz_sqrt_pd(0xFF, v)));
+			__m512d r=FuncMath::pow8(v, e, valid);
+			_mm512_mask_storeu_pd(&xasy[i], positive, r);
+			if ((positive&valid)!=positive)
+				for (k=0; k<8; k++)
+					if (((positive&~valid)>>k)&1)
+						xasy[i+k]=pow(v[k], e[k]);
+		}
+		for (; i<nx; i++)
+			if (x[i]>0)
+				xasy[i]=pow1(x[i], asyexp(x[i], i, nx, beta));
+	}
+#endif
+};
+
+#endif //P1_FUNCKERNELS_H
@@ -0,0 +1,379 @@
+/*
+ * FuncMath.h
+ *
+ * File defining the elementary functions (sine, cosine and power) of the vector kernels of the
+ * test functions, with scalar, AVX2 and AVX-512 versions.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef P1_FUNCMATH_H
+#define P1_FUNCMATH_H
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FUNC_KERNELS_X86
+#include <immintrin.h>
+//Kernel compiled for the instruction set isa. Contraction is disabled, as avx512f implies FMA
+#define FUNC_KERNEL(isa) __attribute__((target(isa), optimize("fp-contract=off")))
+#endif
+
+#ifdef __GNUC__
+//Scalar code which must not fuse multiplications and additions, whatever the flags of the program
+#define FUNC_NOCONTRACT __attribute__((optimize("fp-contract=off")))
+#else
+#define FUNC_NOCONTRACT
+#endif
+
+/**
+ * Class with the elementary functions used by the kernels (see FuncKernels), which do not call
+ * the C library, so that they can be computed for 4 (AVX2) or 8 (AVX-512) values at a time. The
+ * scalar version of each function computes exactly the same operations as the vector ones (the
+ * exact products use the function fma), so the results are the same in all the versions.
+ *
+ * Algorithms and error bounds, compared with the C library (glibc, correctly rounded in nearly
+ * all the cases). The bounds were measured over millions of random arguments of the ranges used
+ * by the test functions:
+ * - sin, cos: the argument is reduced to [-PI/4,PI/4] with 2/PI split in three doubles and exact
+ *   products, and the polynomials of fdlibm are used. Absolute error below 1.2e-16; at most 1 ulp
+ *   when the result is above 0.01 in magnitude, and up to 5 ulp near the zeros. The time does not
+ *   grow with the argument, as it does in the C library for arguments above 1e8.
+ *   Arguments above 2^45 in magnitude, infinities and NaNs are not reduced (see TRIG_LIMIT).
+ * - pow(x,e), for x>0: exp(e*log(x)), with the logarithm (fdlibm) and the product kept in two
+ *   doubles, and the exponential of fdlibm extended with the low part. At most 1 ulp for |e|<=6
+ *   (for any x), which covers the exponents of the test functions. The polynomial of the
+ *   logarithm has an absolute error near 2^-57, which is multiplied by e, so larger exponents
+ *   give up to about 1+|e|/12 ulp (3 ulp for e=35, 10 ulp for e=120). The results below
+ *   2^-1022 are rounded twice, and they can have 1 ulp more of error. It is not computed (see
+ *   powvalid) when x is not positive and finite, or when the result overflows or underflows
+ *   (e*log(x) out of [-745,709]).
+ * Note that the C library is not correctly rounded either: pow(x,0.5) differs from sqrt(x) in
+ * the last bit for some x.
+ *
+ * The values which are not computed are given to the C library by the kernels, which also
+ * offer a strict mode where only the C library is used (see FuncKernels).
+ */
+class FuncMath {
+public:
+	/* Limit of the arguments of sin and cos */
+	static constexpr double TRIG_LIMIT=35184372088832.0; //2^45
+
+	/* Constants of sin and cos: 2/PI and PI/2 split in several doubles, and coefficients of the polynomials of fdlibm */
+	static constexpr double TRIG_I1=0.63661977236758138, TRIG_I2=-3.9357353350364972e-17, TRIG_I3=-2.1442872565786008e-33;
+	static constexpr double TRIG_P1=1.5707963267948966, TRIG_P2=6.1232339957367660e-17;
+	static constexpr double COS_C1=4.16666666666666019037e-02, COS_C2=-1.38888888888741095749e-03,
+			COS_C3=2.48015872894767294178e-05, COS_C4=-2.75573143513906633035e-07,
+			COS_C5=2.08757232129817482790e-09, COS_C6=-1.13596475577881948265e-11;
+	static constexpr double SIN_S1=-1.66666666666666324348e-01, SIN_S2=8.33333333332248946124e-03,
+			SIN_S3=-1.98412698298579493134e-04, SIN_S4=2.75573137070700676789e-06,
+			SIN_S5=-2.50507602534068634195e-08, SIN_S6=1.58969099521155010221e-10;
+
+	/* Constants of pow: ln(2) split in two doubles (the first one with 32 zero bits), the coefficients of the logarithm and of the exponential of fdlibm, and limits */
+	static constexpr double LN2_HI=6.93147180369123816490e-01, LN2_LO=1.90821492927058770002e-10,
+			INV_LN2=1.44269504088896338700e+00, SQRT2=1.41421356237309514547;
+	static constexpr double LOG_LG1=6.666666666666735130e-01, LOG_LG2=3.999999999940941908e-01,
+			LOG_LG3=2.857142874366239149e-01, LOG_LG4=2.222219843214978396e-01,
+			LOG_LG5=1.818357216161805012e-01, LOG_LG6=1.531383769920937332e-01,
+			LOG_LG7=1.479819860511658591e-01;
+	static constexpr double EXP_P1=1.66666666666666019037e-01, EXP_P2=-2.77777777770155933842e-03,
+			EXP_P3=6.61375632143793436117e-05, EXP_P4=-1.65339022054652515390e-06,
+			EXP_P5=4.13813679705723846039e-08;
+	static constexpr double POW_MIN=-745.0, POW_MAX=709.0;
+	static constexpr double TWO54=18014398509481984.0, MIN_NORMAL=2.2250738585072014e-308;
+
+	/**
+	 * Cosine (sine if sine is true) of x, for |x|<=TRIG_LIMIT
+	 */
+	FUNC_NOCONTRACT
+	static double trig1(double x, bool sine){
+		//x*2/PI=n+fh+fl, with n integer and |fh|<=0.5
+		double p=x*TRIG_I1, e=fma(x, TRIG_I1, -p), n=nearbyint(p), r=p-n;
+		double t=fma(x, TRIG_I3, fma(x, TRIG_I2, e));
+		double fh=r+t, bb=fh-r, fl=(r-(fh-bb))+(t-bb);
+		//Reduced argument gh+gl=(fh+fl)*PI/2
+		double gh=fh*TRIG_P1, gl=fma(fh, TRIG_P1, -gh)+(fh*TRIG_P2+fl*TRIG_P1);
+		double z=gh*gh, w=z*z;
+		double rc=z*(COS_C1+z*(COS_C2+z*(COS_C3+z*(COS_C4+z*(COS_C5+z*COS_C6)))));
+		double hz=0.5*z, wc=1.0-hz;
+		double c=wc+(((1.0-wc)-hz)+(z*rc-gh*gl));
+		double rs=SIN_S2+z*(SIN_S3+z*SIN_S4)+z*w*(SIN_S5+z*SIN_S6), v=z*gh;
+		double s=gh-((z*(0.5*gl-v*rs)-gl)-v*SIN_S1);
+		//Quadrant: cos(x) is c, -s, -c or s, and sin(x) is cos(x) three quadrants later
+		double q=n+(sine ? 3.0 : 0.0);
+		q=q-4.0*floor(q*0.25);
+		double y=(q==1.0 || q==3.0) ? s : c;
+		if (q==1.0 || q==2.0)
+			y=y*-1.0;
+		return y;
+	}
+
+	/**
+	 * Power x^e, if powvalid is true. Otherwise, the result is not valid
+	 */
+	FUNC_NOCONTRACT
+	static double pow1(double x, double e, bool &powvalid){
+		//x=2^k*m, with m in [sqrt(2)/2,sqrt(2)]
+		double k=0.0, xs=x;
+		if (xs<MIN_NORMAL)
+		{
+			xs=xs*TWO54;
+			k=-54.0;
+		}
+		uint64_t bits;
+		memcpy(&bits, &xs, sizeof(bits));
+		k=k+((double) ((bits>>52)&0x7FF)-1023.0);
+		bits=(bits&0x000FFFFFFFFFFFFFULL)|0x3FF0000000000000ULL;
+		double m;
+		memcpy(&m, &bits, sizeof(m));
+		if (m>SQRT2)
+		{
+			m=m*0.5;
+			k=k+1.0;
+		}
+		//log(m)=f-hfsq+s*(hfsq+R) (fdlibm), with f-hfsq kept in two doubles
+		double f=m-1.0, s=f/(2.0+f), z=s*s, w=z*z;
+		double t1=w*(LOG_LG2+w*(LOG_LG4+w*LOG_LG6)), t2=z*(LOG_LG1+w*(LOG_LG3+w*(LOG_LG5+w*LOG_LG7)));
+		double hf=0.5*f, hh=hf*f, hl=fma(hf, f, -hh);
+		double c=s*(hh+(t2+t1));
+		double a=f-hh, lo=((f-a)-hh)+(c-hl);
+		//log(x)=k*ln(2)+log(m)=lh+ll
+		double khi=k*LN2_HI, hi=khi+a, bb=hi-khi;
+		lo=lo+(((khi-(hi-bb))+(a-bb))+k*LN2_LO);
+		double lh=hi+lo, ll=lo-(lh-hi);
+		//e*log(x)=yh+yl
+		double yh=e*lh, yl=fma(e, lh, -yh)+e*ll;
+		powvalid=(x>0.0 && x<INFINITY && yh>=POW_MIN && yh<=POW_MAX);
+		//exp(yh+yl)=2^n*exp(r) (fdlibm, with the low part yl in elo). The values which are not valid can have any value of n
+		double n=powvalid ? nearbyint(yh*INV_LN2) : 0.0;
+		double ehi=yh-n*LN2_HI, elo=n*LN2_LO-yl;
+		double r=ehi-elo, t=r*r;
+		double cc=r-t*(EXP_P1+t*(EXP_P2+t*(EXP_P3+t*(EXP_P4+t*EXP_P5))));
+		double y=1.0-((elo-(r*cc)/(2.0-cc))-ehi);
+		//2^n in two factors, so that none of them is subnormal
+		double na=floor(n*0.5), nb=n-na;
+		return y*pow2(na)*pow2(nb);
+	}
+
+#ifdef FUNC_KERNELS_X86
+	/**
+	 * AVX2 version of trig1
+	 */
+	FUNC_KERNEL("avx2,fma")
+	static __m256d trig4(__m256d x, bool sine){
+		__m256d i1=_mm256_set1_pd(TRIG_I1), p1=_mm256_set1_pd(TRIG_P1), one=_mm256_set1_pd(1.0), half=_mm256_set1_pd(0.5);
+		__m256d p=_mm256_mul_pd(x, i1), e=_mm256_fmsub_pd(x, i1, p);
+		__m256d n=_mm256_round_pd(p, _MM_FROUND_TO_NEAREST_INT|_MM_FROUND_NO_EXC), r=_mm256_sub_pd(p, n);
+		__m256d t=_mm256_fmadd_pd(x, _mm256_set1_pd(TRIG_I3), _mm256_fmadd_pd(x, _mm256_set1_pd(TRIG_I2), e));
+		__m256d fh=_mm256_add_pd(r, t), bb=_mm256_sub_pd(fh, r);
+		__m256d fl=_mm256_add_pd(_mm256_sub_pd(r, _mm256_sub_pd(fh, bb)), _mm256_sub_pd(t, bb));
+		__m256d gh=_mm256_mul_pd(fh, p1);
+		__m256d gl=_mm256_add_pd(_mm256_fmsub_pd(fh, p1, gh),
+				_mm256_add_pd(_mm256_mul_pd(fh, _mm256_set1_pd(TRIG_P2)), _mm256_mul_pd(fl, p1)));
+		__m256d z=_mm256_mul_pd(gh, gh), w=_mm256_mul_pd(z, z);
+		__m256d rc=_mm256_add_pd(_mm256_set1_pd(COS_C5), _mm256_mul_pd(z, _mm256_set1_pd(COS_C6)));
+		rc=_mm256_add_pd(_mm256_set1_pd(COS_C4), _mm256_mul_pd(z, rc));
+		rc=_mm256_add_pd(_mm256_set1_pd(COS_C3), _mm256_mul_pd(z, rc));
+		rc=_mm256_add_pd(_mm256_set1_pd(COS_C2), _mm256_mul_pd(z, rc));
+		rc=_mm256_mul_pd(z, _mm256_add_pd(_mm256_set1_pd(COS_C1), _mm256_mul_pd(z, rc)));
+		__m256d hz=_mm256_mul_pd(half, z), wc=_mm256_sub_pd(one, hz);
+		__m256d c=_mm256_add_pd(wc, _mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(one, wc), hz),
+				_mm256_sub_pd(_mm256_mul_pd(z, rc), _mm256_mul_pd(gh, gl))));
+		__m256d rs=_mm256_add_pd(_mm256_add_pd(_mm256_set1_pd(SIN_S2),
+				_mm256_mul_pd(z, _mm256_add_pd(_mm256_set1_pd(SIN_S3), _mm256_mul_pd(z, _mm256_set1_pd(SIN_S4))))),
+				_mm256_mul_pd(_mm256_mul_pd(z, w), _mm256_add_pd(_mm256_set1_pd(SIN_S5), _mm256_mul_pd(z, _mm256_set1_pd(SIN_S6)))));
+		__m256d v=_mm256_mul_pd(z, gh);
+		__m256d s=_mm256_sub_pd(gh, _mm256_sub_pd(_mm256_sub_pd(_mm256_mul_pd(z, _mm256_sub_pd(_mm256_mul_pd(half, gl),
+				_mm256_mul_pd(v, rs))), gl), _mm256_mul_pd(v, _mm256_set1_pd(SIN_S1))));
+		__m256d q=_mm256_add_pd(n, _mm256_set1_pd(sine ? 3.0 : 0.0));
+		q=_mm256_sub_pd(q, _mm256_mul_pd(_mm256_set1_pd(4.0), _mm256_floor_pd(_mm256_mul_pd(q, _mm256_set1_pd(0.25)))));
+		__m256d q1=_mm256_cmp_pd(q, one, _CMP_EQ_OQ), q2=_mm256_cmp_pd(q, _mm256_set1_pd(2.0), _CMP_EQ_OQ),
+				q3=_mm256_cmp_pd(q, _mm256_set1_pd(3.0), _CMP_EQ_OQ);
+		__m256d y=_mm256_blendv_pd(c, s, _mm256_or_pd(q1, q3));
+		return _mm256_blendv_pd(y, _mm256_mul_pd(y, _mm256_set1_pd(-1.0)), _mm256_or_pd(q1, q2));
+	}
+
+	/* 2^n for integer values n in [-1022,1023] */
+	FUNC_KERNEL("avx2,fma")
+	static __m256d pow2_4(__m256d n){
+		__m256d magic=_mm256_set1_pd(6755399441055744.0); //2^52+2^51
+		__m256i k=_mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(n, magic)), _mm256_castpd_si256(magic));
+		return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(k, _mm256_set1_epi64x(1023)), 52));
+	}
+
+	/**
+	 * AVX2 version of pow1. valid gets a bit for each value (as _mm256_movemask_pd)
+	 */
+	FUNC_KERNEL("avx2,fma")
+	static __m256d pow4(__m256d x, __m256d e, int &valid){
+		__m256d one=_mm256_set1_pd(1.0), half=_mm256_set1_pd(0.5);
+		__m256d sub=_mm256_cmp_pd(x, _mm256_set1_pd(MIN_NORMAL), _CMP_LT_OQ);
+		__m256d xs=_mm256_blendv_pd(x, _mm256_mul_pd(x, _mm256_set1_pd(TWO54)), sub);
+		__m256d k=_mm256_and_pd(sub, _mm256_set1_pd(-54.0));
+		__m256i bits=_mm256_castpd_si256(xs);
+		__m256i ex=_mm256_and_si256(_mm256_srli_epi64(bits, 52), _mm256_set1_epi64x(0x7FF));
+		__m256d exd=_mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(ex, _mm256_set1_epi64x(0x4330000000000000LL))),
+				_mm256_set1_pd(4503599627370496.0)); //2^52
+		k=_mm256_add_pd(k, _mm256_sub_pd(exd, _mm256_set1_pd(1023.0)));
+		__m256d m=_mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)),
+				_mm256_set1_epi64x(0x3FF0000000000000LL)));
+		__m256d big=_mm256_cmp_pd(m, _mm256_set1_pd(SQRT2), _CMP_GT_OQ);
+		m=_mm256_blendv_pd(m, _mm256_mul_pd(m, half), big);
+		k=_mm256_blendv_pd(k, _mm256_add_pd(k, one), big);
+
+		__m256d f=_mm256_sub_pd(m, one), s=_mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+		__m256d z=_mm256_mul_pd(s, s), w=_mm256_mul_pd(z, z);
+		__m256d t1=_mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(LOG_LG2), _mm256_mul_pd(w,
+				_mm256_add_pd(_mm256_set1_pd(LOG_LG4), _mm256_mul_pd(w, _mm256_set1_pd(LOG_LG6))))));
+		__m256d t2=_mm256_add_pd(_mm256_set1_pd(LOG_LG5), _mm256_mul_pd(w, _mm256_set1_pd(LOG_LG7)));
+		t2=_mm256_add_pd(_mm256_set1_pd(LOG_LG3), _mm256_mul_pd(w, t2));
+		t2=_mm256_mul_pd(z, _mm256_add_pd(_mm256_set1_pd(LOG_LG1), _mm256_mul_pd(w, t2)));
+		__m256d hf=_mm256_mul_pd(half, f), hh=_mm256_mul_pd(hf, f), hl=_mm256_fmsub_pd(hf, f, hh);
+		__m256d c=_mm256_mul_pd(s, _mm256_add_pd(hh, _mm256_add_pd(t2, t1)));
+		__m256d a=_mm256_sub_pd(f, hh);
+		__m256d lo=_mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(f, a), hh), _mm256_sub_pd(c, hl));
+		__m256d khi=_mm256_mul_pd(k, _mm256_set1_pd(LN2_HI)), hi=_mm256_add_pd(khi, a), bb=_mm256_sub_pd(hi, khi);
+		lo=_mm256_add_pd(lo, _mm256_add_pd(_mm256_add_pd(_mm256_sub_pd(khi, _mm256_sub_pd(hi, bb)), _mm256_sub_pd(a, bb)),
+				_mm256_mul_pd(k, _mm256_set1_pd(LN2_LO))));
+		__m256d lh=_mm256_add_pd(hi, lo), ll=_mm256_sub_pd(lo, _mm256_sub_pd(lh, hi));
+		__m256d yh=_mm256_mul_pd(e, lh), yl=_mm256_add_pd(_mm256_fmsub_pd(e, lh, yh), _mm256_mul_pd(e, ll));
+
+		__m256d ok=_mm256_and_pd(_mm256_and_pd(_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_GT_OQ),
+				_mm256_cmp_pd(x, _mm256_set1_pd(INFINITY), _CMP_LT_OQ)),
+				_mm256_and_pd(_mm256_cmp_pd(yh, _mm256_set1_pd(POW_MIN), _CMP_GE_OQ),
+				_mm256_cmp_pd(yh, _mm256_set1_pd(POW_MAX), _CMP_LE_OQ)));
+		valid=_mm256_movemask_pd(ok);
+
+		__m256d n=_mm256_round_pd(_mm256_mul_pd(yh, _mm256_set1_pd(INV_LN2)), _MM_FROUND_TO_NEAREST_INT|_MM_FROUND_NO_EXC);
+		//Lanes which are not valid can have any value of n
+		n=_mm256_and_pd(ok, n);
+		__m256d ehi=_mm256_sub_pd(yh, _mm256_mul_pd(n, _mm256_set1_pd(LN2_HI)));
+		__m256d elo=_mm256_sub_pd(_mm256_mul_pd(n, _mm256_set1_pd(LN2_LO)), yl);
+		__m256d r=_mm256_sub_pd(ehi, elo), t=_mm256_mul_pd(r, r);
+		__m256d cc=_mm256_add_pd(_mm256_set1_pd(EXP_P4), _mm256_mul_pd(t, _mm256_set1_pd(EXP_P5)));
+		cc=_mm256_add_pd(_mm256_set1_pd(EXP_P3), _mm256_mul_pd(t, cc));
+		cc=_mm256_add_pd(_mm256_set1_pd(EXP_P2), _mm256_mul_pd(t, cc));
+		cc=_mm256_sub_pd(r, _mm256_mul_pd(t, _mm256_add_pd(_mm256_set1_pd(EXP_P1), _mm256_mul_pd(t, cc))));
+		__m256d y=_mm256_sub_pd(one, _mm256_sub_pd(_mm256_sub_pd(elo, _mm256_div_pd(_mm256_mul_pd(r, cc),
+				_mm256_sub_pd(_mm256_set1_pd(2.0), cc))), ehi));
+		__m256d na=_mm256_floor_pd(_mm256_mul_pd(n, half)), nb=_mm256_sub_pd(n, na);
+		return _mm256_mul_pd(_mm256_mul_pd(y, pow2_4(na)), pow2_4(nb));
+	}
+
+	/**
+	 * AVX-512 version of trig1
+	 */
+	FUNC_KERNEL("avx512f")
+	static __m512d trig8(__m512d x, bool sine){
+		__m512d i1=_mm512_set1_pd(TRIG_I1), p1=_mm512_set1_pd(TRIG_P1), one=_mm512_set1_pd(1.0), half=_mm512_set1_pd(0.5);
+		__m512d p=_mm512_mul_pd(x, i1), e=_mm512_fmsub_pd(x, i1, p);
+		__m512d n=_mm512_maskz_roundscale_pd(0xFF, p, _MM_FROUND_TO_NEAREST_INT|_MM_FROUND_NO_EXC), r=_mm512_sub_pd(p, n);
+		__m512d t=_mm512_fmadd_pd(x, _mm512_set1_pd(TRIG_I3), _mm512_fmadd_pd(x, _mm512_set1_pd(TRIG_I2), e));
+		__m512d fh=_mm512_add_pd(r, t), bb=_mm512_sub_pd(fh, r);
+		__m512d fl=_mm512_add_pd(_mm512_sub_pd(r, _mm512_sub_pd(fh, bb)), _mm512_sub_pd(t, bb));
+		__m512d gh=_mm512_mul_pd(fh, p1);
+		__m512d gl=_mm512_add_pd(_mm512_fmsub_pd(fh, p1, gh),
+				_mm512_add_pd(_mm512_mul_pd(fh, _mm512_set1_pd(TRIG_P2)), _mm512_mul_pd(fl, p1)));
+		__m512d z=_mm512_mul_pd(gh, gh), w=_mm512_mul_pd(z, z);
+		__m512d rc=_mm512_add_pd(_mm512_set1_pd(COS_C5), _mm512_mul_pd(z, _mm512_set1_pd(COS_C6)));
+		rc=_mm512_add_pd(_mm512_set1_pd(COS_C4), _mm512_mul_pd(z, rc));
+		rc=_mm512_add_pd(_mm512_set1_pd(COS_C3), _mm512_mul_pd(z, rc));
+		rc=_mm512_add_pd(_mm512_set1_pd(COS_C2), _mm512_mul_pd(z, rc));
+		rc=_mm512_mul_pd(z, _mm512_add_pd(_mm512_set1_pd(COS_C1), _mm512_mul_pd(z, rc)));
+		__m512d hz=_mm512_mul_pd(half, z), wc=_mm512_sub_pd(one, hz);
+		__m512d c=_mm512_add_pd(wc, _mm512_add_pd(_mm512_sub_pd(_mm512_sub_pd(one, wc), hz),
+				_mm512_sub_pd(_mm512_mul_pd(z, rc), _mm512_mul_pd(gh, gl))));
+		__m512d rs=_mm512_add_pd(_mm512_add_pd(_mm512_set1_pd(SIN_S2),
+				_mm512_mul_pd(z, _mm512_add_pd(_mm512_set1_pd(SIN_S3), _mm512_mul_pd(z, _mm512_set1_pd(SIN_S4))))),
+				_mm512_mul_pd(_mm512_mul_pd(z, w), _mm512_add_pd(_mm512_set1_pd(SIN_S5), _mm512_mul_pd(z, _mm512_set1_pd(SIN_S6)))));
+		__m512d v=_mm512_mul_pd(z, gh);
+		__m512d s=_mm512_sub_pd(gh, _mm512_sub_pd(_mm512_sub_pd(_mm512_mul_pd(z, _mm512_sub_pd(_mm512_mul_pd(half, gl),
+				_mm512_mul_pd(v, rs))), gl), _mm512_mul_pd(v, _mm512_set1_pd(SIN_S1))));
+		__m512d q=_mm512_add_pd(n, _mm512_set1_pd(sine ? 3.0 : 0.0));
+		q=_mm512_sub_pd(q, _mm512_mul_pd(_mm512_set1_pd(4.0),
+				_mm512_maskz_roundscale_pd(0xFF, _mm512_mul_pd(q, _mm512_set1_pd(0.25)), _MM_FROUND_TO_NEG_INF|_MM_FROUND_NO_EXC)));
+		__mmask8 q1=_mm512_cmp_pd_mask(q, one, _CMP_EQ_OQ), q2=_mm512_cmp_pd_mask(q, _mm512_set1_pd(2.0), _CMP_EQ_OQ),
+				q3=_mm512_cmp_pd_mask(q, _mm512_set1_pd(3.0), _CMP_EQ_OQ);
+		__m512d y=_mm512_mask_blend_pd(q1|q3, c, s);
+		return _mm512_mask_mul_pd(y, q1|q2, y, _mm512_set1_pd(-1.0));
+	}
+
+	/* 2^n for integer values n in [-1022,1023] */
+	FUNC_KERNEL("avx512f")
+	static __m512d pow2_8(__m512d n){
+		__m512d magic=_mm512_set1_pd(6755399441055744.0); //2^52+2^51
+		__m512i k=_mm512_sub_epi64(_mm512_castpd_si512(_mm512_add_pd(n, magic)), _mm512_castpd_si512(magic));
+		return _mm512_castsi512_pd(_mm512_maskz_slli_epi64(0xFF, _mm512_add_epi64(k, _mm512_set1_epi64(1023)), 52));
+	}
+
+	/**
+	 * AVX-512 version of pow1. valid gets a bit for each value
+	 */
+	FUNC_KERNEL("avx512f")
+	static __m512d pow8(__m512d x, __m512d e, __mmask8 &valid){
+		__m512d one=_mm512_set1_pd(1.0), half=_mm512_set1_pd(0.5);
+		__mmask8 sub=_mm512_cmp_pd_mask(x, _mm512_set1_pd(MIN_NORMAL), _CMP_LT_OQ);
+		__m512d xs=_mm512_mask_mul_pd(x, sub, x, _mm512_set1_pd(TWO54));
+		__m512d k=_mm512_maskz_mov_pd(sub, _mm512_set1_pd(-54.0));
+		__m512i bits=_mm512_castpd_si512(xs);
+		__m512i ex=_mm512_and_si512(_mm512_maskz_srli_epi64(0xFF, bits, 52), _mm512_set1_epi64(0x7FF));
+		__m512d exd=_mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(ex, _mm512_set1_epi64(0x4330000000000000LL))),
+				_mm512_set1_pd(4503599627370496.0)); //2^52
+		k=_mm512_add_pd(k, _mm512_sub_pd(exd, _mm512_set1_pd(1023.0)));
+		__m512d m=_mm512_castsi512_pd(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi64(0x000FFFFFFFFFFFFFLL)),
+				_mm512_set1_epi64(0x3FF0000000000000LL)));
+		__mmask8 big=_mm512_cmp_pd_mask(m, _mm512_set1_pd(SQRT2), _CMP_GT_OQ);
+		m=_mm512_mask_mul_pd(m, big, m, half);
+		k=_mm512_mask_add_pd(k, big, k, one);
+
+		__m512d f=_mm512_sub_pd(m, one), s=_mm512_div_pd(f, _mm512_add_pd(_mm512_set1_pd(2.0), f));
+		__m512d z=_mm512_mul_pd(s, s), w=_mm512_mul_pd(z, z);
+		__m512d t1=_mm512_mul_pd(w, _mm512_add_pd(_mm512_set1_pd(LOG_LG2), _mm512_mul_pd(w,
+				_mm512_add_pd(_mm512_set1_pd(LOG_LG4), _mm512_mul_pd(w, _mm512_set1_pd(LOG_LG6))))));
+		__m512d t2=_mm512_add_pd(_mm512_set1_pd(LOG_LG5), _mm512_mul_pd(w, _mm512_set1_pd(LOG_LG7)));
+		t2=_mm512_add_pd(_mm512_set1_pd(LOG_LG3), _mm512_mul_pd(w, t2));
+		t2=_mm512_mul_pd(z, _mm512_add_pd(_mm512_set1_pd(LOG_LG1), _mm512_mul_pd(w, t2)));
+		__m512d hf=_mm512_mul_pd(half, f), hh=_mm512_mul_pd(hf, f), hl=_mm512_fmsub_pd(hf, f, hh);
+		__m512d c=_mm512_mul_pd(s, _mm512_add_pd(hh, _mm512_add_pd(t2, t1)));
+		__m512d a=_mm512_sub_pd(f, hh);
+		__m512d lo=_mm512_add_pd(_mm512_sub_pd(_mm512_sub_pd(f, a), hh), _mm512_sub_pd(c, hl));
+		__m512d khi=_mm512_mul_pd(k, _mm512_set1_pd(LN2_HI)), hi=_mm512_add_pd(khi, a), bb=_mm512_sub_pd(hi, khi);
+		lo=_mm512_add_pd(lo, _mm512_add_pd(_mm512_add_pd(_mm512_sub_pd(khi, _mm512_sub_pd(hi, bb)), _mm512_sub_pd(a, bb)),
+				_mm512_mul_pd(k, _mm512_set1_pd(LN2_LO))));
+		__m512d lh=_mm512_add_pd(hi, lo), ll=_mm512_sub_pd(lo, _mm512_sub_pd(lh, hi));
+		__m512d yh=_mm512_mul_pd(e, lh), yl=_mm512_add_pd(_mm512_fmsub_pd(e, lh, yh), _mm512_mul_pd(e, ll));
+
+		valid=_mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_GT_OQ) & _mm512_cmp_pd_mask(x, _mm512_set1_pd(INFINITY), _CMP_LT_OQ)
+				& _mm512_cmp_pd_mask(yh, _mm512_set1_pd(POW_MIN), _CMP_GE_OQ) & _mm512_cmp_pd_mask(yh, _mm512_set1_pd(POW_MAX), _CMP_LE_OQ);
+
+		//Lanes which are not valid can have any value of n
+		__m512d n=_mm512_maskz_roundscale_pd(valid, _mm512_mul_pd(yh, _mm512_set1_pd(INV_LN2)), _MM_FROUND_TO_NEAREST_INT|_MM_FROUND_NO_EXC);
+		__m512d ehi=_mm512_sub_pd(yh, _mm512_mul_pd(n, _mm512_set1_pd(LN2_HI)));
+		__m512d elo=_mm512_sub_pd(_mm512_mul_pd(n, _mm512_set1_pd(LN2_LO)), yl);
+		__m512d r=_mm512_sub_pd(ehi, elo), t=_mm512_mul_pd(r, r);
+		__m512d cc=_mm512_add_pd(_mm512_set1_pd(EXP_P4), _mm512_mul_pd(t, _mm512_set1_pd(EXP_P5)));
+		cc=_mm512_add_pd(_mm512_set1_pd(EXP_P3), _mm512_mul_pd(t, cc));
+		cc=_mm512_add_pd(_mm512_set1_pd(EXP_P2), _mm512_mul_pd(t, cc));
+		cc=_mm512_sub_pd(r, _mm512_mul_pd(t, _mm512_add_pd(_mm512_set1_pd(EXP_P1), _mm512_mul_pd(t, cc))));
+		__m512d y=_mm512_sub_pd(one, _mm512_sub_pd(_mm512_sub_pd(elo, _mm512_div_pd(_mm512_mul_pd(r, cc),
+				_mm512_sub_pd(_mm512_set1_pd(2.0), cc))), ehi));
+		__m512d na=_mm512_maskz_roundscale_pd(0xFF, _mm512_mul_pd(n, half), _MM_FROUND_TO_NEG_INF|_MM_FROUND_NO_EXC);
+		__m512d nb=_mm512_sub_pd(n, na);
+		return _mm512_mul_pd(_mm512_mul_pd(y, pow2_8(na)), pow2_8(nb));
+	}
+#endif
+
+private:
+	/* 2^n for integer values n in [-1022,1023] */
+	static double pow2(double n){
+		uint64_t bits=(uint64_t) ((int64_t) n+1023)<<52;
+		double p;
+		memcpy(&p, &bits, sizeof(p));
+		return p;
+	}
+};
+
+#endif //P1_FUNCMATH_H
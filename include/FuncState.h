@@ -0,0 +1,54 @@
+/*
+ * FuncState.h
+ *
+ * File defining the class FuncState.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef P1_FUNCSTATE_H
+#define P1_FUNCSTATE_H
+
+#include "RPOEvalState.h"
+#include "RPOGene.h"
+#include <vector>
+
+using namespace std;
+
+/**
+ * Class storing the intermediate vectors of the evaluation of one solution, so that the
+ * change of a single parameter can be evaluated without repeating the whole shift and rotation.
+ * It is the evaluation state of Func (Func::State, see RPOObjective).
+ *
+ * For each component of the function (one for the basic functions, cf_num for the composition
+ * ones) it keeps the shifted and shrunk vector y and its first rotation z = M*y. Changing the
+ * parameter i only moves y[i], so z is updated with the column i of M in O(D) (or with the
+ * column of its group, in O(k), if the rotations are grouped).
+ */
+class FuncState : public RPOEvalState {
+	friend class Func;
+
+	/**
+	 * Properties of the class
+	 * _params Values of the parameters the cached vectors correspond to
+	 * _x Point in the search space (parameters centred in 0)
+	 * _y Shifted and shrunk vectors, one block of D values per component
+	 * _z First rotation of each block of _y
+	 * _sums Sums of the tabulated terms, for the separable functions (see Func::buildtables)
+	 * _numUpdates Number of incremental updates since the vectors were fully computed
+	 */
+	vector<RPOGene> _params;
+	vector<double> _x, _y, _z, _sums;
+	unsigned _numUpdates;
+
+public:
+	/**
+	 * Constructor
+	 */
+	FuncState(){
+		_numUpdates = 0;
+	}
+};
+
+#endif //P1_FUNCSTATE_H
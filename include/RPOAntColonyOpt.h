@@ -49,11 +49,17 @@ class RPOAntColonyOpt: public RPOMetaheuristic {
 		 *  _candidateListSize Number of options to consider when including a new component in
 		 *                     the solution. This variable also accelerate the construction process
 		 *                     avoiding the consideration of all possible solutions.
+		 *  _alternatives, _significances Alternatives of the ant in its last step, and their
+		 *                                relevance. The operations are stored by value and
+		 *                                reused from one step to the next, so no operation is
+		 *                                allocated while the ants build their solutions
 		 */
 		RPOAntColonyOpt *_colony;
 		RPOSolution *_sol;
 		unordered_set<unsigned> _paramsLeft;
 		double _candidateListSize;
+		vector<RPOObjectAssignmentOperation> _alternatives;
+		vector<double> _significances;
 
 		/**
 		 * Function which sums the values of a vector. It will be used to know the sum of the values
@@ -74,7 +80,7 @@ class RPOAntColonyOpt: public RPOMetaheuristic {
 		 * @param[out] significances Vector with the relevance of the different alternatives created
 		 */
 		void createAlternatives(
-				vector<RPOObjectAssignmentOperation*> &alternatives,
+				vector<RPOObjectAssignmentOperation> &alternatives,
 				vector<double> &significances) {
 
 			//Obtain the information of the ant
@@ -114,12 +120,11 @@ class RPOAntColonyOpt: public RPOMetaheuristic {
 					 * 2. Obtain its relevance as densityOfTheObject^beta * amountOfPheromona^alpha
 					 * 3. Include the operation in the alternatives and the relevance in significances
 					 */
-					RPOObjectAssignmentOperation *al =
-							new RPOObjectAssignmentOperation();
+					alternatives.emplace_back();
+					RPOObjectAssignmentOperation &al = alternatives.back();
 					double density = deltaFitness
 							/ fabs(paramValue-_sol->parameterValue(indexParam));
-					al->setValues(indexParam, paramValue, deltaFitness);
-					alternatives.push_back(al);
+					al.setValues(indexParam, paramValue, deltaFitness);
 					double significance = pow(density, beta)
 							* pow(phMatrix.at(indexParam)->at(j), alpha);
 					significances.push_back(significance);
@@ -182,15 +187,11 @@ class RPOAntColonyOpt: public RPOMetaheuristic {
 		}
 
 		/**
-		 * Function which frees the memory of the alternatives created by the ant
-		 * @param[in,out] alt Vector with the alternatives to be freed
+		 * Function which discards the alternatives created by the ant (their memory is kept for
+		 * the next step)
+		 * @param[in,out] alt Vector with the alternatives to be discarded
 		 */
-		void freeAlternatives(vector<RPOObjectAssignmentOperation*> &alt) {
-
-			for (auto altOp : alt) {
-				delete altOp;
-			}
-
+		void freeAlternatives(vector<RPOObjectAssignmentOperation> &alt) {
 			alt.clear();
 		}
 
@@ -245,8 +246,9 @@ class RPOAntColonyOpt: public RPOMetaheuristic {
 			} else {
 
 				//Create the alternatives
-				vector<RPOObjectAssignmentOperation*> alternatives;
-				vector<double> significances;
+				vector<RPOObjectAssignmentOperation> &alternatives = _alternatives;
+				vector<double> &significances = _significances;
+				significances.clear();
 				createAlternatives(alternatives, significances);
 
 				//If the ant did not find alternatives, exit
@@ -268,14 +270,14 @@ class RPOAntColonyOpt: public RPOMetaheuristic {
 				}
 
 				//Assign the alternative selected in opSelected
-				unsigned indexParam = alternatives.at(opSelected)->getParam();
+				unsigned indexParam = alternatives.at(opSelected).getParam();
 				unsigned paramValue =
-						alternatives.at(opSelected)->getparamValue();
+						alternatives.at(opSelected).getparamValue();
 				double deltaFitness =
-						alternatives.at(opSelected)->getDeltaFitness();
+						alternatives.at(opSelected).getDeltaFitness();
 				operation.setValues(indexParam, paramValue, deltaFitness);
 
-				//Free the memory of the alternatives
+				//Discard the alternatives
 				freeAlternatives(alternatives);
 			}
 
@@ -294,6 +296,15 @@ class RPOAntColonyOpt: public RPOMetaheuristic {
 		RPOSolution & getSolution() {
 			return *_sol;
 		}
+
+		/**
+		 * Function which exchanges the solution constructed by the ant with another one, without
+		 * copying their parameters. The ant resets its solution before constructing the next one
+		 * @param[in,out] sol Solution which is exchanged with the one of the ant
+		 */
+		void swapSolution(RPOSolution &sol) {
+			_sol->swap(sol);
+		}
 	};
 
 protected:
@@ -383,19 +394,28 @@ protected:
 				movingAnts.erase(iAnt);
 			}
 		}
+	}
 
-		//Update the best solution
+	/**
+	 * Function which updates the best solution with the best one constructed by the ants.
+	 * The solution of that ant is exchanged with _bestSolution instead of copied, so it has to
+	 * be called once the statistics of the iteration have been stored
+	 */
+	void updateBestSolution() {
 		double bestFitness = _bestSolution->getFitness();
+		RPOAnt *bestAnt = NULL;
 
 		for (auto ant : _ants) {
-			RPOSolution &sol = ant->getSolution();
 			double currentFitness = ant->getSolution().getFitness();
 
 			if (RPOEvaluator::compare(currentFitness, bestFitness) > 0) {
-				_bestSolution->copy(sol);
+				bestAnt = ant;
 				bestFitness = currentFitness;
 			}
 		}
+
+		if (bestAnt != NULL)
+			bestAnt->swapSolution(*_bestSolution);
 	}
 
 	/**
@@ -427,13 +447,15 @@ protected:
 	/**
 	 * Function which runs a iteration of the ACO algorithm, that is:
 	 * 1. Release the ants to construct their solutions.
-     * 2. Update the pheromone matrix based on the best solution.
+     * 2. Update the best solution.
+     * 3. Update the pheromone matrix based on the best solution.
 	 */
 	void iterate() {
 
 		//Release the ants
 		releaseAnts();
 		saveStatistics();
+		updateBestSolution();
 
 		//Apply pheromone with the best solution
 		unsigned numParams = _instance->getNumParameters();
@@ -0,0 +1,111 @@
+/**
+ * RPOBestTracker.h
+ *
+ * File defining the class RPOBestTracker.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef __RPOBESTTRACKER_H__
+#define __RPOBESTTRACKER_H__
+
+#include <RPOSolution.h>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Class which keeps the best solution found by a metaheuristic which moves a single solution one
+ * parameter at a time (simulated annealing, tabu search), without copying the current solution
+ * every time it improves the best one.
+ *
+ * When the current solution becomes the best one, only its fitness is stored, and from then on
+ * the old value of every parameter changed in the current solution is written in a log. The best
+ * solution is the current one with the changes of the log undone, and it is only built (copying
+ * the current solution and undoing the log) when it is read, or when the log reaches the number
+ * of parameters, so that the log does not grow without limit. Thus an improving run costs O(1)
+ * per new best solution instead of a full copy, and the copies are at most one per D changes.
+ */
+class RPOBestTracker {
+
+	/**
+	 * Properties of the class
+	 * _best Solution where the best solution is built
+	 * _current Solution which is moved by the metaheuristic
+	 * _bestFitness Fitness of the best solution
+	 * _pending Whether _best is behind (the best solution is _current with the log undone)
+	 * _maxLog Number of changes after which the best solution is built (the number of parameters)
+	 * _logParams, _logValues Parameters changed in _current since it was the best solution,
+	 *                        and their values in the best solution
+	 */
+	RPOSolution *_best;
+	RPOSolution *_current;
+	double _bestFitness;
+	bool _pending;
+	size_t _maxLog;
+	vector<int> _logParams;
+	vector<int> _logValues;
+
+	/* Function which builds the best solution in _best */
+	void materialise();
+
+public:
+	/**
+	 * Constructor
+	 */
+	RPOBestTracker(){
+		_best = NULL;
+		_current = NULL;
+		_bestFitness = 0;
+		_pending = false;
+		_maxLog = 0;
+	}
+
+	/**
+	 * Function which starts the tracking, with the current solution as the best one
+	 * @param[in] best Solution where the best solution is kept (it is copied from current)
+	 * @param[in] current Solution moved by the metaheuristic
+	 */
+	void track(RPOSolution &best, RPOSolution &current);
+
+	/**
+	 * Function which has to be called before changing a parameter of the current solution
+	 * @param[in] indexParam Index of the parameter which is going to change
+	 */
+	void notifyChange(int indexParam){
+		if (!_pending)
+			return;
+		if (_logParams.size() >= _maxLog)
+			materialise();
+		else{
+			_logParams.push_back(indexParam);
+			_logValues.push_back(_current->parameterValue(indexParam));
+		}
+	}
+
+	/**
+	 * Function which makes the current solution the best one
+	 */
+	void update(){
+		_bestFitness = _current->getFitness();
+		_pending = true;
+		_logParams.clear();
+		_logValues.clear();
+	}
+
+	double getFitness() const{
+		return _bestFitness;
+	}
+
+	/**
+	 * Function which returns the best solution, building it if it is behind
+	 */
+	RPOSolution &getSolution(){
+		if (_pending)
+			materialise();
+		return *_best;
+	}
+};
+
+#endif
@@ -14,6 +14,7 @@
 #include <RPOSolution.h>
 #include <Solution.h>
 #include <RPOInstance.h>
+#include <RPOSolutionPool.h>
 #include <vector>
 
 using namespace std;
@@ -31,10 +32,12 @@ protected:
 	 *  - _numObjs Stores the number of objects in the instance considered to reduce the number of queries
 	 *             to the instance object
 	 *  - _crossProb crossover probability
+	 *  - _pool Pool the descendants are taken from (NULL if they are allocated with new)
 	 */
 	RPOInstance *_instance;
 	unsigned _numParam;
 	double _crossProb;
+	RPOSolutionPool *_pool;
 
 	/**
 	 * Function which cross two solutions according to the crossover probability. In case the crossover is not
@@ -42,11 +45,11 @@ protected:
 	 * @param[in] s1 first parent
 	 * @param[in] s2 second parent
 	 * @return New object with the solution descendant after considering the crossover of s1 and s2.
-	 *         The solution is dynamically allocated in memory. It is the responsibility of the one invoking
-	 *         this method to manage this memory correctly.
+	 *         The solution is dynamically allocated in memory (or acquired from the pool). It is the
+	 *         responsibility of the one invoking this method to manage this memory correctly.
 	 */
 	RPOSolution * cross(Solution *s1, Solution *s2) {
-		RPOSolution * sol = new RPOSolution(*_instance);
+		RPOSolution * sol = (_pool != NULL) ? _pool->acquire() : new RPOSolution(*_instance);
 		RPOSolution * sol1 = (RPOSolution *) s1;
 		RPOSolution * sol2 = (RPOSolution *) s2;
 
@@ -80,19 +83,30 @@ public:
 	 * Constructor
 	 * @param[in] crossProb Crossover probability
 	 * @param[in] instance Instance of the problem considered
+	 * @param[in] pool Pool the descendants are taken from, or NULL for allocating them with new
 	 */
-	RPOCrossoverOperator(double crossProb, RPOInstance &instance) {
+	RPOCrossoverOperator(double crossProb, RPOInstance &instance, RPOSolutionPool *pool = NULL) {
 		_instance = &instance;
 		_numParam = instance.getNumParameters();
 		_crossProb = crossProb;
+		_pool = pool;
+	}
+
+	/**
+	 * Function which sets the pool the descendants are taken from
+	 * @param[in] pool Pool of solutions, or NULL for allocating the descendants with new
+	 */
+	void setPool(RPOSolutionPool *pool) {
+		_pool = pool;
 	}
 
 	/**
 	 * Function which applies crossover to a population of parents
 	 * @param[in] parents Parent vector. The crossover is applied to every two consecutive parents (1,2), (3,4)...
 	 * @param[out] offspring Vector where the descendants are stored.
-	 * IMPORTANT: this function allocates memory dynamically for the new solutions in offspring,
-	 * so it is the responsibility of the one invoking this method to manage this memory correctly.
+	 * IMPORTANT: this function allocates memory dynamically for the new solutions in offspring (or
+	 * acquires them from the pool), so it is the responsibility of the one invoking this method to
+	 * manage this memory correctly.
 	 */
 	void cross(vector<Solution*> &parents, vector<Solution*> &offspring) {
 
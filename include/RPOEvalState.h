@@ -0,0 +1,54 @@
+/**
+ * RPOEvalState.h
+ *
+ * File defining the class RPOEvalState.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef __RPOEVALSTATE_H__
+#define __RPOEVALSTATE_H__
+
+/**
+ * Base class of the evaluation states of the solutions: the data that an objective keeps with a
+ * solution to evaluate the changes of its parameters faster (see RPOObjective::State).
+ *
+ * Each solution owns a state of the State type of the objective chosen at compile time, created
+ * the first time a change of the solution is evaluated. The instance gives it to the objective
+ * with a static cast to that type, so the evaluations do not make virtual calls (the destructor
+ * is the only virtual function).
+ */
+class RPOEvalState {
+protected:
+	/**
+	 * Properties of the class
+	 * _valid Whether the data of the state have been computed (if not, the objective has to
+	 *        compute them before using them)
+	 */
+	bool _valid;
+
+public:
+	/**
+	 * Constructor
+	 */
+	RPOEvalState(){
+		_valid = false;
+	}
+
+	virtual ~RPOEvalState(){
+	}
+
+	/**
+	 * Function which discards the data of the state, so that they are recomputed in the next evaluation
+	 */
+	void invalidate(){
+		_valid = false;
+	}
+
+	bool isValid() const{
+		return _valid;
+	}
+};
+
+#endif
@@ -0,0 +1,140 @@
+/**
+ * RPOEvaluationContext.h
+ *
+ * File defining the class RPOEvaluationContext.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef __RPOEVALUATIONCONTEXT_H__
+#define __RPOEVALUATIONCONTEXT_H__
+
+#include <stddef.h>
+#include <atomic>
+#include <vector>
+
+using namespace std;
+
+class RPOSolution;
+class RPOFitnessCache;
+
+/**
+ * Class which keeps the accounting of the evaluations of a run: the number of evaluations, read
+ * by the stop conditions, and the cache used by the evaluator. Each run owns its context, so
+ * several metaheuristics can run at the same time, each one with its own budget.
+ *
+ * RPOEvaluator uses the context bound to the calling thread (see Scope), or a default context
+ * of the process if no context is bound. The threads which evaluate solutions of the same run
+ * in parallel bind the same context.
+ *
+ * The number of evaluations is split into NUM_SHARDS counters, each one in its own cache line,
+ * and every thread increments the one of its shard, so the threads do not contend for the same
+ * counter. The counters are added when the number of evaluations is read.
+ *
+ * The cache (RPOFitnessCache) is not thread-safe: a context with a cache can only be used by one
+ * thread at a time, and two contexts used at the same time need different caches.
+ */
+class RPOEvaluationContext {
+	friend class RPOEvaluator;
+
+public:
+	/**
+	 * Number of counters of the evaluations
+	 */
+	static const unsigned NUM_SHARDS = 16;
+
+private:
+	/* Counter of a shard, alone in its cache line */
+	struct alignas(64) Shard {
+		atomic<unsigned long> count;
+	};
+
+	/**
+	 * Properties of the class
+	 * _shards Counters of the evaluations
+	 * _cache Cache of the fitness of the solutions already evaluated (NULL if it is not used)
+	 * _misses, _missIndices, _missFitness Solutions of RPOEvaluator::computeFitnessBatch which
+	 *                                     are not in the cache, and their fitness (kept to avoid
+	 *                                     allocating them in each call)
+	 * _current Context bound to each thread
+	 */
+	Shard _shards[NUM_SHARDS];
+	RPOFitnessCache *_cache;
+	vector<RPOSolution*> _misses;
+	vector<unsigned> _missIndices;
+	vector<double> _missFitness;
+	static thread_local RPOEvaluationContext *_current;
+
+	/* Shard of the calling thread (the threads take the shards in turns) */
+	static unsigned shard();
+
+	/* Constructor of the default context of the process */
+	explicit RPOEvaluationContext(RPOFitnessCache *cache);
+
+	RPOEvaluationContext(const RPOEvaluationContext &);
+	RPOEvaluationContext &operator=(const RPOEvaluationContext &);
+
+public:
+	/**
+	 * Constructor. The context starts with no evaluations and with the cache of the context of
+	 * the calling thread (see current), so a cache set for the process is used by all the runs.
+	 */
+	RPOEvaluationContext();
+
+	/**
+	 * Object which binds a context to the calling thread while it exists (the previous context
+	 * is bound again when it is destroyed)
+	 */
+	class Scope {
+		RPOEvaluationContext *_previous;
+
+	public:
+		Scope(RPOEvaluationContext &context){
+			_previous = _current;
+			_current = &context;
+		}
+
+		~Scope(){
+			_current = _previous;
+		}
+	};
+
+	/**
+	 * Function which returns the context bound to the calling thread, or the default context of
+	 * the process if there is none
+	 */
+	static RPOEvaluationContext &current();
+
+	/**
+	 * Function which counts evaluations
+	 * @param[in] numEvaluations Number of evaluations
+	 */
+	void addEvaluations(unsigned long numEvaluations){
+		_shards[shard()].count.fetch_add(numEvaluations, memory_order_relaxed);
+	}
+
+	/**
+	 * Function which returns the number of evaluations counted by all the threads
+	 */
+	unsigned long getNumEvaluations() const;
+
+	/**
+	 * Function which sets the number of evaluations to 0
+	 */
+	void resetNumEvaluations();
+
+	/**
+	 * Function which sets the cache of the context (see RPOEvaluator::setCache)
+	 * @param[in] cache Cache to be used, or NULL for not using any
+	 */
+	void setCache(RPOFitnessCache *cache){
+		_cache = cache;
+	}
+
+	RPOFitnessCache *getCache() const{
+		return _cache;
+	}
+};
+
+#endif
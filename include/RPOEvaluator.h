@@ -13,19 +13,19 @@
 
 #include "RPOInstance.h"
 #include "RPOSolution.h"
+#include "RPOFitnessCache.h"
+#include "RPOEvaluationContext.h"
 
 /**
  * Class for obtaining the fitness of a solution of the RPO
+ *
+ * Every evaluation (computeFitness, computeDeltaFitness, and each solution of
+ * computeDeltaFitnessSweep and computeFitnessBatch) is counted in the evaluation context of the
+ * calling thread (see RPOEvaluationContext), which also holds the cache.
  */
 
 class RPOEvaluator {
 
-protected:
-	/**
-	 * Variable counting the number of solutions that have been evaluated using computeFitness or computeDeltaFitness
-	 */
-	static unsigned _numEvaluations;
-
 public:
 	/**
 	 * Function obtaining the fitness of a solution
@@ -53,15 +53,65 @@ public:
 	static double computeDeltaFitness(RPOInstance &instance, RPOSolution &solution, int indexParam, int newParamValue);
 
 	/**
-	 * Function which resets the internal variable storing the number of evaluations.
+	 * Function which obtains the difference of fitness for every value of a parameter of the
+	 * solution, in a single pass. It is equivalent to calling computeDeltaFitness for each value,
+	 * but much faster. The difference for the current value of the parameter is exactly 0, and it
+	 * is not counted as an evaluation.
+	 * @param[in] instance Reference to an object with information about the instance of the RPO
+	 * @param[in] solution Reference to an object with the information of the current solution
+	 * @param[in] indexParam Index of the parameter to change
+	 * @param[out] deltaFitness Difference of fitness for each value of the parameter
+	 * @param[in] countEvaluations Whether the other values are counted as evaluations. The local
+	 *                             searches count the values they scan, the current one included,
+	 *                             with addEvaluations instead, as their loops of
+	 *                             computeDeltaFitness did
+	 */
+	static void computeDeltaFitnessSweep(RPOInstance &instance, RPOSolution &solution, int indexParam, vector<double> &deltaFitness,
+			bool countEvaluations=true);
+
+	/**
+	 * Function obtaining the fitness of several solutions. It is equivalent to calling computeFitness
+	 * for each of them, but faster, as the solutions are evaluated together.
+	 * @param[in] instance Reference to an object with the information of the RPO instance.
+	 * @param[in] solutions Solutions to be evaluated. Their fitness is not assigned.
+	 * @param[out] fitness Fitness of each solution
+	 */
+	static void computeFitnessBatch(RPOInstance &instance, vector<RPOSolution*> &solutions, vector<double> &fitness);
+
+	/**
+	 * Function which sets the cache used by computeFitness, computeDeltaFitness and computeFitnessBatch
+	 * in the context of the calling thread. A hit is counted as an evaluation only if
+	 * cache->hitsCountAsEvaluations(). The cache is not deleted by the evaluator.
+	 * @param[in] cache Cache to be used, or NULL for not using any
+	 */
+	static void setCache(RPOFitnessCache *cache){
+		RPOEvaluationContext::current().setCache(cache);
+	}
+
+	static RPOFitnessCache *getCache(){
+		return RPOEvaluationContext::current().getCache();
+	}
+
+	/**
+	 * Function which counts evaluations in the context of the calling thread (the values of a
+	 * sweep which are used, see computeDeltaFitnessSweep)
+	 * @param[in] numEvaluations Number of evaluations
+	 */
+	static void addEvaluations(unsigned long numEvaluations){
+		RPOEvaluationContext::current().addEvaluations(numEvaluations);
+	}
+
+	/**
+	 * Function which resets the number of evaluations of the context of the calling thread.
 	 */
 	static void resetNumEvaluations();
 
 	/**
-	 * Function for observing the number of times any solution has been evaluated.
+	 * Function for observing the number of times any solution has been evaluated in the context
+	 * of the calling thread.
 	 */
-	static unsigned getNumEvaluations() {
-		return _numEvaluations;
+	static unsigned long getNumEvaluations() {
+		return RPOEvaluationContext::current().getNumEvaluations();
 	}
 
 	/**
@@ -0,0 +1,142 @@
+/**
+ * RPOFitnessCache.h
+ *
+ * File defining the class RPOFitnessCache.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef __RPOFITNESSCACHE_H__
+#define __RPOFITNESSCACHE_H__
+
+#include "RPOInstance.h"
+#include "RPOGene.h"
+#include <stdint.h>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Class which stores the fitness of the last solutions evaluated, so that a solution which is
+ * evaluated again (the GA recreates identical offspring, the ants converge to the same
+ * assignments...) is not computed again. It is used by RPOEvaluator when it is given one with
+ * RPOEvaluator::setCache.
+ *
+ * The cache has a fixed number of entries (open addressing). A solution is looked up in a window
+ * of PROBE_LENGTH consecutive entries, starting at the one given by its fingerprint. When the
+ * window is full, an entry is replaced with the CLOCK algorithm: the entries which have been
+ * used since the last pass of the hand get a second chance. The parameters are stored as bytes
+ * (one per parameter), so two solutions with the same fingerprint are never mixed up; solutions
+ * with values out of 0..255 are not cached.
+ *
+ * The fingerprint is a Zobrist hash (the xor of a random number for each parameter and value). It
+ * is computed from all the parameters in every lookup, O(D) like the comparison of the parameters
+ * of a found entry, as the solutions do not keep their fingerprint.
+ *
+ * About the evaluation budget: if hitsCountAsEvaluations() is true (the default), a hit is
+ * counted as an evaluation, as if the solution had been computed, so the stop conditions based on
+ * the number of evaluations behave exactly as without the cache, and only the time is saved. If
+ * it is false, the hits are free, and a run with the same budget can explore more solutions.
+ */
+class RPOFitnessCache {
+
+	/**
+	 * Properties of the class
+	 * _mask Number of entries minus 1 (the number of entries is a power of 2)
+	 * _numParams Number of parameters of the solutions
+	 * _hitsCount Whether a hit is counted as an evaluation
+	 * _instanceId Identifier of the instance whose solutions are stored (see RPOInstance::getId), 0 if none
+	 * _zobrist Random number of each parameter and value (_zobrist[param*256+value])
+	 * _hash, _fitness, _used, _ref Fingerprint, fitness, use and reference bit of each entry
+	 * _keys Parameters of the solution of each entry (_numParams bytes per entry)
+	 * _hand Position of the hand of the CLOCK algorithm inside the windows
+	 * _hits, _misses, _evictions Statistics
+	 */
+	unsigned _mask;
+	int _numParams;
+	bool _hitsCount;
+	unsigned long _instanceId;
+	vector<uint64_t> _zobrist;
+	vector<uint64_t> _hash;
+	vector<double> _fitness;
+	vector<unsigned char> _used, _ref, _keys;
+	unsigned _hand;
+	unsigned long _hits, _misses, _evictions;
+
+	/* Fingerprint of the parameters, with the parameter indexParam set to newParamValue (if indexParam>=0). False if a value is not in 0..255 */
+	bool fingerprint(const RPOGene *parameters, int indexParam, int newParamValue, uint64_t &h) const;
+
+	/* Whether the entry stores the parameters, with the parameter indexParam set to newParamValue */
+	bool sameKey(unsigned entry, const RPOGene *parameters, int indexParam, int newParamValue) const;
+
+public:
+	/**
+	 * Number of consecutive entries where a solution can be stored
+	 */
+	static const unsigned PROBE_LENGTH = 8;
+
+	/**
+	 * Constructor
+	 * @param[in] numEntries Maximum number of solutions stored (rounded up to a power of 2)
+	 * @param[in] hitsCountAsEvaluations Whether a hit is counted as an evaluation (see above)
+	 */
+	RPOFitnessCache(unsigned numEntries, bool hitsCountAsEvaluations=true);
+
+	/**
+	 * Function which sets the instance of the solutions. If its identifier (see RPOInstance::getId)
+	 * is not the one of the stored solutions, the cache is emptied: another instance, even at the
+	 * same address, or the same one with another precision does not reuse their fitness values.
+	 * @param[in] instance Instance of the solutions which are going to be looked up
+	 */
+	void setInstance(RPOInstance &instance);
+
+	/**
+	 * Function which looks up the fitness of a solution
+	 * @param[in] parameters Parameters of the solution
+	 * @param[in] indexParam If it is not negative, the parameter indexParam is considered to take
+	 *                       the value newParamValue
+	 * @param[in] newParamValue New value of the parameter indexParam
+	 * @param[out] fitness Fitness of the solution, if it is found
+	 * @return Whether the solution was found
+	 */
+	bool lookup(const RPOGene *parameters, int indexParam, int newParamValue, double &fitness);
+
+	/**
+	 * Function which stores the fitness of a solution (the arguments are the ones of lookup)
+	 */
+	void insert(const RPOGene *parameters, int indexParam, int newParamValue, double fitness);
+
+	/**
+	 * Function which removes all the solutions of the cache
+	 */
+	void clear();
+
+	/**
+	 * Function which tells whether a hit has to be counted against the evaluation budget
+	 */
+	bool hitsCountAsEvaluations() const{
+		return _hitsCount;
+	}
+
+	unsigned long getHits() const{
+		return _hits;
+	}
+
+	unsigned long getMisses() const{
+		return _misses;
+	}
+
+	unsigned long getEvictions() const{
+		return _evictions;
+	}
+
+	/**
+	 * Function which resets the counters of hits, misses and evictions
+	 */
+	void resetStatistics(){
+		_hits=_misses=_evictions=0;
+	}
+};
+
+#endif
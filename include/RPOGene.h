@@ -0,0 +1,28 @@
+/**
+ * RPOGene.h
+ *
+ * File defining the type RPOGene.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef __RPOGENE_H__
+#define __RPOGENE_H__
+
+#include <stdint.h>
+
+/**
+ * Type of the values of the parameters stored in the solutions (and passed to the objective). The
+ * values of the test functions (0..200) fit in a byte, which makes the solutions four times
+ * smaller than with int, so the copies, the fingerprints of the cache and the scans of the
+ * populations are cheaper. Objectives with wider parameters are compiled with a wider type, for
+ * example -DRPO_GENE=uint16_t (RPOInstance checks that the values of the objective fit in it).
+ */
+#ifndef RPO_GENE
+#define RPO_GENE uint8_t
+#endif
+
+typedef RPO_GENE RPOGene;
+
+#endif
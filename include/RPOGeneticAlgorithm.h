@@ -17,6 +17,7 @@
 #include <RPOCrossoverOperator.h>
 #include <RPOMutationOperator.h>
 #include <TournamentSelector.h>
+#include <RPOSolutionPool.h>
 #include <vector>
 #include <iostream>
 
@@ -35,6 +36,10 @@ protected:
 	 *  _crossoverOp Crossover operator
 	 *  _mutOp Mutation operator
 	 *  _instancia Instance of the problem considered
+	 *  _pool Pool of the solutions of the population and the offspring, which are reused from
+	 *        one generation to the next instead of allocated and deleted
+	 *  _parents, _offspring Parents and offspring of the current generation (kept to avoid
+	 *                       allocating them in each generation)
 	 */
 	unsigned _popSize;
 	vector<Solution*> _population;
@@ -42,6 +47,9 @@ protected:
 	RPOCrossoverOperator *_crossoverOp = NULL;
 	RPOMutationOperator *_mutOp = NULL;
 	RPOInstance *_instance = NULL;
+	RPOSolutionPool *_pool = NULL;
+	vector<Solution*> _parents;
+	vector<Solution*> _offspring;
 
 	/**
 	 * Vectors where the results will be stored
@@ -55,6 +63,14 @@ protected:
 	vector<double> _offMeanResults;
 	vector<double> _bestPerIterations;
 
+	/**
+	 * Auxiliary vectors for evaluating several solutions at once
+	 *  _toEvaluate Solutions to be evaluated
+	 *  _batchFitness Fitness values obtained for them
+	 */
+	vector<RPOSolution*> _toEvaluate;
+	vector<double> _batchFitness;
+
 	/**
 	 * Function which tries to find the index of the best solution in a vector
 	 * @param[in] set Vector with solutions
@@ -113,7 +129,7 @@ protected:
 		 * 3. If the best solution in _population is better than the best solution in _offspring
 		 *   a. Find the index of the worst solution in _offspring
 		 *   b. Make that solution copy the information of the best solution in _population
-		 * 4. Delete the individuals in the current population (freeing memory)
+		 * 4. Release the individuals in the current population (to the pool)
 		 * 5. Store the individuals of _offspring in current population
 		 */
 		unsigned int indexBestPop = indexBest(_population);
@@ -124,9 +140,9 @@ protected:
 			offspring[worst]->copy(*_population[indexBestPop]);
 		}
 
-		//Delete the individuals in current population
+		//Release the individuals in current population
 		for (unsigned i = 0; i < _popSize; i++) {
-			delete (_population.back());
+			_pool->release(_population.back());
 			_population.pop_back();
 		}
 
@@ -146,26 +162,31 @@ protected:
 	 */
 	void evaluate(vector<Solution*> &set) {
 
+		/**
+		 *
+		 * A new functionality has been included in Solution to detect if its fitness was previously calculated.
+		 * which is useful when the descendant is a copy of the parent.
+		 * In this way, only those solutions which has an invalid fitness will be evaluated.
+		 * They are all evaluated together, and then processed in the same order as in the set
+		 */
+		_toEvaluate.clear();
 		for (Solution *sol : set) {
 			RPOSolution *s = (RPOSolution*) sol;
+			if (!(s->hasValidFitness()))
+				_toEvaluate.push_back(s);
+		}
+		RPOEvaluator::computeFitnessBatch(*_instance, _toEvaluate, _batchFitness);
 
-			/**
-			 *
-			 * A new functionality has been included in Solution to detect if its fitness was previously calculated.
-			 * which is useful when the descendant is a copy of the parent.
-             * In this way, only those solutions which has an invalid fitness will be evaluated
-			 */
-			if (!(s->hasValidFitness())) {
-
-				double fitness= RPOEvaluator::computeFitness(*_instance, *s);
+		for (unsigned i = 0; i < _toEvaluate.size(); i++) {
+			RPOSolution *s = _toEvaluate[i];
+			double fitness = _batchFitness[i];
 
-				_results.push_back(fitness);
-				s->setFitness(fitness);
+			_results.push_back(fitness);
+			s->setFitness(fitness);
 
 
-				if (RPOEvaluator::compare(fitness, _bestSolution->getFitness()) > 0){
-					_bestSolution->copy(*s);
-				}
+			if (RPOEvaluator::compare(fitness, _bestSolution->getFitness()) > 0){
+				_bestSolution->copy(*s);
 			}
 		}
 	}
@@ -187,17 +208,22 @@ protected:
 		 *
 		 * For each iteration:
 		 *  1. Generate a random solution
-		 *  2. Evaluate it and assign its fitness
-		 *  3. Update the _bestSolution (remember to use the function compare(,))
-		 *  4. Include the solution in the population (done)
+		 *  2. Include the solution in the population (done)
+		 * Then, evaluate all of them at once and assign their fitness
 		 */
+		_toEvaluate.clear();
 		for (unsigned i = 0; i < popSize; i++) {
-			RPOSolution *sol = new RPOSolution(*_instance);
-			RPOSolGenerator::genRandomSol(*_instance, *sol);
-			double fitness = RPOEvaluator::computeFitness(*_instance, *sol);
-			_results.push_back(fitness);
+			RPOSolution *sol = _pool->acquire();
+			RPOSolGenerator::genRandomParameters(*_instance, *sol);
+			_toEvaluate.push_back(sol);
 			_population.push_back(sol);
 		}
+		RPOEvaluator::computeFitnessBatch(*_instance, _toEvaluate, _batchFitness);
+
+		for (unsigned i = 0; i < popSize; i++) {
+			_toEvaluate[i]->setFitness(_batchFitness[i]);
+			_results.push_back(_batchFitness[i]);
+		}
 	}
 
 	/**
@@ -233,9 +259,11 @@ public:
 	 */
 	virtual ~RPOGeneticAlgorithm() {
 
-		for (unsigned i = 0; i < _popSize; i++) {
-			delete (_population.back());
-			_population.pop_back();
+		//The individuals belong to the pool
+		_population.clear();
+		if (_pool != NULL) {
+			delete _pool;
+			_pool = NULL;
 		}
 
 		if (_bestSolution != NULL){
@@ -271,16 +299,16 @@ public:
 					_bestPerIterations.push_back(
 							_population.at(indexBest(_population))->getFitness());
 
-					vector<Solution*> parents;
-					_selector->select(_population,parents); // Selection of parents
+					_parents.clear();
+					_selector->select(_population,_parents); // Selection of parents
 
-					vector<Solution*> offspring;
-					_crossoverOp->cross(parents, offspring); // Crossover
-					_mutOp->mutate(offspring);// Mutation
-					evaluate(offspring);// Evaluate
-					_offMeanResults.push_back(computeMeanFitness(offspring));
+					_offspring.clear();
+					_crossoverOp->cross(_parents, _offspring); // Crossover
+					_mutOp->mutate(_offspring);// Mutation
+					evaluate(_offspring);// Evaluate
+					_offMeanResults.push_back(computeMeanFitness(_offspring));
 
-					selectNewPopulation(offspring); // Selection of the offspring (replacement)
+					selectNewPopulation(_offspring); // Selection of the offspring (replacement)
 					stopCondition.notifyIteration();
 				}
 
@@ -314,6 +342,11 @@ public:
 
 		_popSize = popSize;
 
+		//The population and the offspring of a generation are alive at the same time
+		if (_pool == NULL) {
+			_pool = new RPOSolutionPool(*_instance, 2 * _popSize);
+		}
+
 		/**
 		 * It is configured to use binary tournament selection, the genetic operators
 		 * implemented and the corresponding probabilities. But other operators could be used
@@ -322,6 +355,7 @@ public:
 		if (_crossoverOp == NULL) {
 			_crossoverOp = new RPOCrossoverOperator(0.8, *_instance);
 		}
+		_crossoverOp->setPool(_pool);
 
 		if (_mutOp == NULL) {
 			_mutOp = new RPOMutationOperator((0.25 / _instance->getNumParameters()),*_instance);
@@ -340,7 +374,8 @@ public:
 	}
 
 	/**
-	 * Function which assigns a new crossover operator
+	 * Function which assigns a new crossover operator (it takes the descendants from the pool of
+	 * the GA, see RPOCrossoverOperator::setPool)
 	 */
 	void setCrossoverOp(RPOCrossoverOperator* crossoverOp) {
 
@@ -348,6 +383,8 @@ public:
 			delete _crossoverOp;
 
 		_crossoverOp = crossoverOp;
+		if (_crossoverOp != NULL)
+			_crossoverOp->setPool(_pool);
 	}
 
 	/**
@@ -10,35 +10,120 @@
 #ifndef __RPOINSTANCE_H__
 #define __RPOINSTANCE_H__
 
+/**
+ * Objective function of the instances used by the metaheuristics (see RPOObjective). It is
+ * chosen at compile time, for example with -DRPO_OBJECTIVE=Sphere -DRPO_OBJECTIVE_HEADER='"Sphere.h"'
+ */
+#ifndef RPO_OBJECTIVE
+#define RPO_OBJECTIVE Func
+#define RPO_OBJECTIVE_HEADER "Func.h"
+#endif
+
+#include RPO_OBJECTIVE_HEADER
+
+template<class Objective> class RPOBasicInstance;
+
+/**
+ * Instance of the objective chosen at compile time, the one used by the metaheuristics
+ */
+typedef RPOBasicInstance<RPO_OBJECTIVE> RPOInstance;
+
 #ifndef __RPOSOLUTION_H__
 #include "RPOSolution.h"
 #else
 class RPOSolution;
 #endif
 
-#include "Func.h"
+#include "RPOGene.h"
 #include <time.h>
 #include <stdlib.h>
+#include <iostream>
+#include <limits>
+#include <utility>
 #include <vector>
 
 /**
- * Class for storing the information of an instance of the problem RPO
+ * Class for storing the information of an instance of the problem RPO. It is a template on the
+ * objective function (see RPOObjective), whose functions are called directly, without virtual
+ * calls. Its functions are defined in RPOInstance.cpp for the objective RPO_OBJECTIVE.
  */
-class RPOInstance {
+template<class Objective>
+class RPOBasicInstance {
+public:
+	/**
+	 * Objective function of the instance
+	 */
+	typedef Objective ObjectiveType;
+
 protected:
 	int _numParameters;
-	Func func;
+	Objective func;
+
+
+	/**
+	 * Fitness of the solution with all the parameters at 0 (the one of a new RPOSolution), computed
+	 * by the constructor and by setPrecision, so the threads only read it (see getInitialFitness)
+	 */
+	double _initialFitness;
+
+	/**
+	 * Identifier of the instance and of its settings (see getId)
+	 */
+	unsigned long _id;
+
+	/**
+	 * Function which returns a new identifier, different from all the previous ones and from 0
+	 */
+	static unsigned long newId();
+
+	/**
+	 * Function which returns the vector for the pointers to the parameters of the solutions of a
+	 * batch (see getFitness with a vector of solutions). There is one per thread, like the
+	 * workspace of Func, so that several threads can evaluate batches of the same instance, and
+	 * it is kept to avoid allocating it in each call.
+	 */
+	static vector<const RPOGene*> &batchParameters();
+
+	/**
+	 * Function which computes _initialFitness with the current settings of the objective
+	 */
+	void computeInitialFitness();
+
+	/**
+	 * Function which returns the evaluation state of a solution as the State of the objective.
+	 * The solutions create the state of RPO_OBJECTIVE, the only objective this class is
+	 * instantiated for (see RPOSolution::getEvalState), so the cast is static.
+	 */
+	typename Objective::State &state(RPOSolution &solution);
 
 public:
 	/**
-	 * Default constructor
+	 * Default constructor. The arguments are given to the constructor of the objective; with Func:
+	 * @param[in] size_param Number of parameters (the dimension of the test function, any value
+	 *                       from 2; the dimensions without data files use generated data)
+	 * @param[in] numfunc Number of the test function (1-28)
+	 * @param[in] dataSeed Seed of the generated data (see Func::Func)
+	 * @param[in] rotationGroup Size of the groups of the grouped rotations, or 0 for dense
+	 *                          rotations (see Func::Func). Grouped rotations make the instances
+	 *                          with thousands of parameters practical
 	 */
-	RPOInstance(int size_param,int numfunc);
+	template<class... Args>
+	explicit RPOBasicInstance(Args&&... args): func(std::forward<Args>(args)...) {
+		_numParameters=func.getNumParameters();
+		_id=newId();
+		for (int i=0; i<_numParameters; i++)
+			if (func.getWidthOfParameter(i)-1 > (int) numeric_limits<RPOGene>::max())
+			{
+				cerr<<endl<<"Error: The values of the parameters do not fit in RPOGene (see RPOGene.h)."<<endl;
+				exit(-3);
+			}
+		computeInitialFitness();
+	}
 
 	/**
 	 * Destructor
 	 */
-	~RPOInstance();
+	~RPOBasicInstance();
 
 	/**
 	 * Function for reading an input file.
@@ -55,7 +140,86 @@ public:
 		return _numParameters;
 	}
 
+	inline int getFunctionNumber() const{
+		return func.getFunctionNumber();
+	}
+
+	/**
+	 * Function which returns the identifier of the instance. It is different in every instance
+	 * (also in one created where a deleted one was), and it changes when a setting which changes
+	 * the fitness values is modified, such as the precision, so the fitness values obtained with the
+	 * same identifier can be reused (see RPOFitnessCache).
+	 */
+	inline unsigned long getId() const{
+		return _id;
+	}
+
+	/**
+	 * Function which sets the precision of the evaluation of the instance (see Func::setPrecision).
+	 * It has to be called before any solution is evaluated or created, as the fitness of the
+	 * existing solutions is not updated (the initial fitness of the new ones is recomputed).
+	 * @param[in] precision Objective::PRECISION_DOUBLE or Objective::PRECISION_MIXED (the
+	 *                      objectives which do not define it only have the double precision)
+	 */
+	inline void setPrecision(int precision){
+		func.setPrecision(precision);
+		_id=newId();
+		computeInitialFitness();
+	}
+
+	inline int getPrecision() const{
+		return func.getPrecision();
+	}
+
+	/**
+	 * Function which returns the number of solutions which are evaluated together faster than
+	 * one by one (see getFitness with a vector of solutions)
+	 */
+	inline int getBatchSize() const{
+		return func.getBatchSize();
+	}
+
 	double getFitness(RPOSolution &solution);
+
+	/**
+	 * Function which returns the fitness of the solution with all the parameters at 0, which is
+	 * the one of every new RPOSolution. It is evaluated when the instance is created (and when its
+	 * precision changes), so building a solution does not cost an evaluation, and several threads
+	 * can build solutions of the same instance.
+	 */
+	inline double getInitialFitness() const{
+		return _initialFitness;
+	}
+
+	/**
+	 * Function which obtains the fitness that the solution would have if the parameter indexParam
+	 * took the value newParamValue, without modifying the solution. It uses the evaluation state of
+	 * the solution (see RPOObjective::fitnessDelta), so with Func the cost of the shift and the
+	 * first rotation is O(D) instead of O(D^2).
+	 * @param[in] solution Solution to be evaluated
+	 * @param[in] indexParam Index of the parameter to change
+	 * @param[in] newParamValue New value of the parameter
+	 * @return Fitness of the modified solution
+	 */
+	double getFitness(RPOSolution &solution, int indexParam, int newParamValue);
+
+	/**
+	 * Function which obtains the fitness of several solutions at once, sharing the rotations
+	 * between them (see RPOObjective::fitnessBatch and Func::fitnessBatch). The solutions are not
+	 * modified, and neither is the instance, so several threads can call it at the same time.
+	 * @param[in] solutions Solutions to be evaluated
+	 * @param[out] fitness Fitness of each solution
+	 */
+	void getFitness(const vector<RPOSolution*> &solutions, vector<double> &fitness) const;
+
+	/**
+	 * Function which obtains the fitness that the solution would have for each value of the
+	 * parameter indexParam, without modifying the solution (see RPOObjective::fitnessSweep).
+	 * @param[in] solution Solution to be evaluated
+	 * @param[in] indexParam Index of the parameter to change
+	 * @param[out] fitness Fitness of the modified solution for each value of the parameter
+	 */
+	void getFitnessSweep(RPOSolution &solution, int indexParam, vector<double> &fitness);
 	void randomPermutation(int numParam, vector<int>& perm);
 };
 
@@ -52,10 +52,10 @@ public:
 	/**
 	 * Function which returns the best solution found up to the moment.
 	 * It is the responsability of each metaheuristic to keep udpate the
-	 * property _bestSolution
+	 * property _bestSolution (or to bring it up to date here, if it builds it lazily)
 	 * @return Best solution found up the moment
 	 */
-	RPOSolution*& getBestSolution(){
+	virtual RPOSolution*& getBestSolution(){
 		return _bestSolution;
 	}
 };
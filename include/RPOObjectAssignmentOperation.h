@@ -59,7 +59,11 @@ public:
 	 */
 	void setValues(int indexParam, int paramValue, double deltaFitness);
 
-	unsigned getParam(){
+	/**
+	 * Function returning the parameter changed by the operation
+	 * @return Index of the parameter, or -1 if the operation has not been given any change
+	 */
+	int getParam(){
 		return _indexParam;
 	}
 
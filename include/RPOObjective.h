@@ -0,0 +1,142 @@
+/**
+ * RPOObjective.h
+ *
+ * File defining the class RPOObjective.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef __RPOOBJECTIVE_H__
+#define __RPOOBJECTIVE_H__
+
+#include "RPOEvalState.h"
+#include "RPOGene.h"
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Base class of the objective functions of the RPO (the functions which give the fitness of a
+ * vector of parameters). The instances are templated on their objective (RPOBasicInstance), so
+ * the evaluations are direct calls, without virtual functions, and the objective can be inlined
+ * in the metaheuristics. The metaheuristics use RPOInstance, the instance of the objective chosen
+ * at compile time with RPO_OBJECTIVE, the class, and RPO_OBJECTIVE_HEADER, the header which
+ * defines it (Func and "Func.h", the 28 functions of CEC 2013, if they are not defined).
+ *
+ * An objective derives from RPOObjective<Objective> (the curiously recurring template pattern),
+ * is built with the arguments given to the constructor of the instance (main.cpp gives the number
+ * of parameters and the number of the function), and has to define:
+ * - int getNumParameters() const: number of parameters
+ * - int getWidthOfParameter(int indexParam) const: number of values of the parameter (0..width-1)
+ * - double fitness(const RPOGene *parameters) const: fitness of the parameters (to maximise)
+ *
+ * The other functions have a default implementation here, based on fitness, which the objective
+ * replaces by defining a function with the same name and arguments when it can do it faster (as
+ * Func does with an incremental evaluation and the evaluation of several solutions together):
+ * - fitnessDelta and fitnessSweep receive the evaluation state of the solution, where they can
+ *   keep whatever they need to evaluate the changes of a parameter faster. Its type is State,
+ *   RPOEvalState by default (which the default functions do not use); an objective which needs
+ *   more defines its own class derived from RPOEvalState and names it State with a typedef
+ *   (FuncState for Func). The state is created by the solution and is kept between evaluations;
+ *   it may correspond to older parameters (the objective brings it up to date) or be invalid
+ *   (RPOEvalState::isValid).
+ * - setPrecision and getPrecision only accept PRECISION_DOUBLE by default.
+ * - getBatchSize is 1 by default.
+ *
+ * The parameters are given as a pointer to the values of the solution (getNumParameters values,
+ * see RPOSolution::getParameters), so an evaluation does not copy nor allocate them.
+ */
+template<class Objective>
+class RPOObjective {
+
+	const Objective &objective() const{
+		return static_cast<const Objective&>(*this);
+	}
+
+public:
+	/**
+	 * Evaluation state of the solutions, see RPOEvalState
+	 */
+	typedef RPOEvalState State;
+
+	/**
+	 * Precisions of the evaluation (see setPrecision):
+	 * PRECISION_DOUBLE Everything in double precision (the default, and the only one of the
+	 *                  objectives which do not define setPrecision)
+	 * PRECISION_MIXED Data stored in single precision and computations in double precision
+	 */
+	enum { PRECISION_DOUBLE, PRECISION_MIXED };
+
+	/**
+	 * Function which obtains the fitness that the parameters would have if the parameter indexParam
+	 * took the value newParamValue
+	 * @param[in] parameters Values of the parameters
+	 * @param[in,out] state Evaluation state of the solution of the parameters
+	 * @param[in] indexParam Index of the parameter to change
+	 * @param[in] newParamValue New value of the parameter
+	 * @return Fitness of the modified parameters
+	 */
+	double fitnessDelta(const RPOGene *parameters, RPOEvalState &state, int indexParam, int newParamValue) const{
+		//The modified parameters are local, so the objective can be shared by several threads
+		vector<RPOGene> changed(parameters, parameters + objective().getNumParameters());
+		changed[indexParam] = newParamValue;
+		return objective().fitness(&changed[0]);
+	}
+
+	/**
+	 * Function which obtains the fitness that the parameters would have for each value of the
+	 * parameter indexParam (the arguments are the ones of fitnessDelta)
+	 * @param[out] fitness Fitness of the modified parameters for each value
+	 */
+	void fitnessSweep(const RPOGene *parameters, RPOEvalState &state, int indexParam, vector<double> &fitness) const{
+		int numValues = objective().getWidthOfParameter(indexParam);
+		vector<RPOGene> changed(parameters, parameters + objective().getNumParameters());
+		fitness.resize(numValues);
+		for (int value = 0; value < numValues; value++){
+			changed[indexParam] = value;
+			fitness[value] = objective().fitness(&changed[0]);
+		}
+	}
+
+	/**
+	 * Function which obtains the fitness of several vectors of parameters
+	 * @param[in] parameters Pointers to the parameters of each solution
+	 * @param[out] fitness Fitness of each solution
+	 */
+	void fitnessBatch(const vector<const RPOGene*> &parameters, vector<double> &fitness) const{
+		fitness.resize(parameters.size());
+		for (unsigned i = 0; i < parameters.size(); i++)
+			fitness[i] = objective().fitness(parameters[i]);
+	}
+
+	/**
+	 * Number of solutions which fitnessBatch evaluates together faster than one by one (the
+	 * callers give it blocks of this size), 1 by default
+	 */
+	int getBatchSize() const{
+		return 1;
+	}
+
+	/**
+	 * Number of the function inside its suite (used by the profiling), 0 by default
+	 */
+	int getFunctionNumber() const{
+		return 0;
+	}
+
+	void setPrecision(int precision){
+		if (precision != PRECISION_DOUBLE){
+			cerr << "Error: The objective only has the double precision." << endl;
+			exit(-1);
+		}
+	}
+
+	int getPrecision() const{
+		return PRECISION_DOUBLE;
+	}
+};
+
+#endif
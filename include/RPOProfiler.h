@@ -0,0 +1,128 @@
+/**
+ * RPOProfiler.h
+ *
+ * File defining the class RPOProfiler and the macros of the profiling of the evaluations.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef __RPOPROFILER_H__
+#define __RPOPROFILER_H__
+
+/**
+ * The profiling is only compiled if RPO_PROFILE is defined (-DRPO_PROFILE). Otherwise the macros
+ * are empty, and nothing is measured:
+ * RPO_PROFILE_EVALUATION(layer, kind, function, numSolutions) Measures the rest of the block as
+ *     an evaluation of the layer (EVALUATOR for RPOEvaluator, OBJECTIVE for the test function)
+ * RPO_PROFILE_RUN(caller) Measures the rest of the block as a run of the caller, and assigns to it
+ *     the evaluations made inside
+ * RPO_PROFILE_DUMP() Writes the results to the file of RPO_PROFILE_FILE (rpo_profile.json if the
+ *     environment variable is not set)
+ */
+#ifdef RPO_PROFILE
+
+#include <chrono>
+#include <ostream>
+
+class RPOProfiler {
+public:
+	/**
+	 * Layers, kinds of evaluation and callers
+	 */
+	enum { EVALUATOR, OBJECTIVE, NUM_LAYERS };
+	enum { FULL, DELTA, SWEEP, BATCH, NUM_KINDS };
+	enum { CALLER_OTHER, CALLER_RS, CALLER_LS, CALLER_SA, CALLER_TS, CALLER_GRASP, CALLER_IG, CALLER_GA, CALLER_ACO, NUM_CALLERS };
+
+	/**
+	 * Number of test functions with their own statistics (the rest are counted as function 0), and
+	 * number of buckets of the histograms: the bucket b counts the latencies of [2^(b-1), 2^b) ns
+	 */
+	static const int MAX_FUNCTIONS = 32;
+	static const int NUM_BUCKETS = 40;
+
+	/**
+	 * Statistics of a set of evaluations: calls, solutions evaluated, total time and histogram of
+	 * the time of the calls
+	 */
+	struct Stats {
+		unsigned long calls, solutions;
+		unsigned long long ns;
+		unsigned long buckets[NUM_BUCKETS];
+	};
+
+	/**
+	 * Object which measures an evaluation, from its construction to its destruction
+	 */
+	class Scope {
+		int _layer, _kind, _function;
+		unsigned long _solutions;
+		std::chrono::steady_clock::time_point _start;
+
+	public:
+		Scope(int layer, int kind, int function, unsigned long numSolutions){
+			_layer = layer;
+			_kind = kind;
+			_function = function;
+			_solutions = numSolutions;
+			_start = std::chrono::steady_clock::now();
+		}
+
+		~Scope(){
+			record(_layer, _kind, _function, _solutions, elapsed(_start));
+		}
+	};
+
+	/**
+	 * Object which measures a run of a caller, from its construction to its destruction
+	 */
+	class RunScope {
+		int _caller, _previous;
+		std::chrono::steady_clock::time_point _start;
+
+	public:
+		RunScope(int caller);
+		~RunScope();
+	};
+
+	/**
+	 * Function which adds an evaluation to the statistics of the calling thread
+	 * @param[in] layer Layer which is measured
+	 * @param[in] kind Kind of evaluation
+	 * @param[in] function Number of the test function
+	 * @param[in] numSolutions Number of solutions evaluated
+	 * @param[in] ns Time of the evaluation, in nanoseconds
+	 */
+	static void record(int layer, int kind, int function, unsigned long numSolutions, unsigned long long ns);
+
+	/**
+	 * Function which writes the statistics of all the threads as JSON
+	 * @param[out] out Stream where they are written
+	 */
+	static void dump(std::ostream &out);
+
+	/**
+	 * Function which writes the statistics of all the threads as JSON to the file of the
+	 * environment variable RPO_PROFILE_FILE, or rpo_profile.json
+	 */
+	static void dump();
+
+	static unsigned long long elapsed(std::chrono::steady_clock::time_point start){
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+	}
+};
+
+#define RPO_PROFILE_EVALUATION(layer, kind, function, numSolutions) \
+	RPOProfiler::Scope rpoProfileScope(RPOProfiler::layer, RPOProfiler::kind, function, numSolutions)
+#define RPO_PROFILE_RUN(caller) RPOProfiler::RunScope rpoProfileRun(RPOProfiler::caller)
+#define RPO_PROFILE_DUMP() RPOProfiler::dump()
+
+#else
+
+#define RPO_PROFILE_EVALUATION(layer, kind, function, numSolutions)
+#define RPO_PROFILE_RUN(caller)
+#define RPO_PROFILE_DUMP()
+
+#endif
+
+#endif
@@ -13,6 +13,7 @@
 
 #include <RPOSolution.h>
 #include <RPOInstance.h>
+#include <RPOBestTracker.h>
 #include <RPOMetaheuristic.h>
 #include <RPOStopCondition.h>
 #include <cstdlib>
@@ -30,6 +31,7 @@ protected:
 	 * _annealingFactor stores the factor used for decreasing the temperature
 	 * _solution stores the solution considered by Simulated Annealing
 	 * _instance is a pointer to the instance of the problem
+	 * _bestTracker keeps _bestSolution without copying _solution in every improvement
 	 */
 	double _T;
 	double _initialProb;
@@ -37,6 +39,7 @@ protected:
 	unsigned _itsPerAnnealing;
 	RPOSolution *_solution;
 	RPOInstance *_instance;
+	RPOBestTracker _bestTracker;
 
 	/**
 	 * Vector of doubles with the quality of the last solution evaluated
@@ -82,6 +85,17 @@ public:
 	 */
 	virtual void run(RPOStopCondition &stopCondition);
 
+	/**
+	 * Function which returns the best solution found up to the moment, building it from the
+	 * current solution if the tracker is behind (see RPOBestTracker)
+	 * @return Best solution found up the moment
+	 */
+	virtual RPOSolution*& getBestSolution(){
+		if (_bestSolution != NULL)
+			_bestTracker.getSolution();
+		return _bestSolution;
+	}
+
 	/**
 	 * Function which assigns the initial solution for the metaheuristic
 	 * @param[in] solution Initial solution over which the simulated annealing is applied
@@ -35,6 +35,15 @@ public:
      *             vector has to be previously reserved.
 	 */
 	static void genRandomSol(RPOInstance &instance, RPOSolution &solution);
+
+	/**
+	 * Function which assigns random values to the parameters of a solution, without evaluating it.
+	 * It is useful when many random solutions are going to be evaluated together with
+	 * RPOEvaluator::computeFitnessBatch.
+	 * @param[in] instance Reference to an object with the information of the RPO instance.
+	 * @param[out] solution Reference to an object representing a solution to the problem.
+	 */
+	static void genRandomParameters(RPOInstance &instance, RPOSolution &solution);
 };
 
 #endif
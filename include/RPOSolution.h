@@ -13,9 +13,8 @@
 
 #ifndef __RPOINSTANCE_H__
 #include "RPOInstance.h"
-#else
-class RPOInstance;
 #endif
+//Otherwise RPOInstance.h has already declared RPOInstance before including this file
 
 #ifndef __SOLUTION_H__
 #include "Solution.h"
@@ -23,10 +22,13 @@ class RPOInstance;
 class Solution;
 #endif
 
+#include "RPOGene.h"
 #include <time.h>
 #include <stdlib.h>
 #include <vector>
 
+class RPOEvalState;
+
 /**
  * Class representing a solution of the problem.
  *
@@ -36,36 +38,83 @@ class Solution;
  */
 class RPOSolution : public Solution {
 protected:
-	std::vector<int> _sol;
+	std::vector<RPOGene> _sol;
 	int _numParametrs;
 	double _fitness;
 	bool _fitnessAssigned;
+	RPOEvalState *_evalState;
+#ifdef RPO_CHECK_FITNESS
+	bool _fitnessStale;
+#endif
 	/* Define the properties of the class
-	 * _sol Integer vector, which will be the internal representation of the solution.
+	 * _sol Vector of the values of the parameters, which will be the internal representation of the
+	 *      solution (stored as RPOGene, a byte by default).
 	 * _numObjs Integer with the number of objects of the problem.
 	 * _fitness double value with quality of the solution.
+	 * _evalState Evaluation state of the solution (of the type State of the objective), created
+	 *            the first time a change of the solution is evaluated (see RPOInstance::getFitness)
+	 * _fitnessStale Whether the parameters have changed since _fitness was assigned (only with
+	 *               RPO_CHECK_FITNESS)
 	 */
 
+	/* The solutions own their evaluation state, so they are not copied implicitly (see copy) */
+	RPOSolution(const RPOSolution &);
+	RPOSolution &operator=(const RPOSolution &);
+
 public:
 	/**
-	 * Constructor
+	 * Constructor. The solution has all the parameters at 0, and the fitness of that solution,
+	 * which the instance evaluates when it is created (see RPOInstance::getInitialFitness).
 	 * @param[in] instance Reference to an object with the information of the RPO instance.
 	 */
 	RPOSolution(RPOInstance &instance);
 
 	~RPOSolution();
 
-	const std::vector<int> getSetofParameters(){
+	/**
+	 * Function which leaves the solution as the constructor does (all the parameters at 0 and the
+	 * fitness of that solution), keeping its memory, so that it can be reused instead of deleted
+	 * and allocated again (see RPOSolutionPool)
+	 * @param[in] instance Instance of the solution
+	 */
+	void reset(RPOInstance &instance);
+
+	const std::vector<RPOGene> &getSetofParameters(){
 		return _sol;
 	}
 
+	/**
+	 * Function returning the values of the parameters, read in place by the evaluations (valid
+	 * while the solution exists; the values change with ChangeParameterTo and copy)
+	 */
+	const RPOGene *getParameters() const{
+		return &_sol[0];
+	}
+
 	void ChangeParameterTo(int parameter, int value);
 
 	int parameterValue(int parameter);
 
+	/**
+	 * Function returning the fitness of the solution. If RPO_CHECK_FITNESS is defined
+	 * (-DRPO_CHECK_FITNESS), reading a fitness which is stale (the parameters have changed with
+	 * ChangeParameterTo and it has not been assigned again) stops the program with an error.
+	 */
 	double getFitness() const;
 
-	void setFitness(double fitness){ _fitness=fitness;}
+	void setFitness(double fitness){
+		_fitness=fitness;
+#ifdef RPO_CHECK_FITNESS
+		_fitnessStale=false;
+#endif
+	}
+
+	/**
+	 * Function returning the evaluation state of the solution, creating it if it does not exist.
+	 * The state does not need to be up to date with the parameters of the solution, the instance
+	 * synchronises it before using it.
+	 */
+	RPOEvalState &getEvalState();
 
 	/**
 	 * Function for knowing whether the fitness of the solution is valid (it will not be valid if an object is moved to other knapsack; and it is valid when the fitness is reasigned)
@@ -76,10 +125,19 @@ public:
 		return _fitnessAssigned;
 	}
 	/**
-	 * Function for copying the information of the solution from another
+	 * Function for copying the information of the solution from another. Only the parameters
+	 * (a single memcpy) and the fitness are copied; the evaluation state is invalidated.
 	 * @param[in] solution Solution from which the information is taken
 	 */
 	virtual void copy(Solution &solution);
+
+	/**
+	 * Function for exchanging the parameters and the fitness of the solution with another one, in
+	 * O(1). The evaluation states are not exchanged: each one keeps the parameters it corresponds
+	 * to, so it is brought up to date the next time it is used.
+	 * @param[in,out] solution Solution with which the information is exchanged
+	 */
+	void swap(RPOSolution &solution);
 };
 
 #endif
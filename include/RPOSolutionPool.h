@@ -0,0 +1,87 @@
+/**
+ * RPOSolutionPool.h
+ *
+ * File defining the class RPOSolutionPool.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef __RPOSOLUTIONPOOL_H__
+#define __RPOSOLUTIONPOOL_H__
+
+#include <RPOSolution.h>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Class which provides the solutions of a metaheuristic which creates and discards many of them
+ * (the offspring of each generation of the GA), so that they are reused instead of allocated and
+ * freed every time.
+ *
+ * The solutions are built in chunks of consecutive objects, so the solutions of a population are
+ * adjacent in memory, and the ones which are released are kept in a free list. Once the pool has
+ * as many solutions as the metaheuristic uses at the same time, acquire and release do not
+ * allocate any memory.
+ *
+ * All the solutions belong to the pool: they are destroyed with it, whether they have been
+ * released or not, and they must not be deleted.
+ */
+class RPOSolutionPool {
+
+	/**
+	 * Properties of the class
+	 * _instance Instance of the solutions
+	 * _chunkSize Number of solutions of each chunk
+	 * _chunks Chunks of solutions
+	 * _free Solutions which are not being used
+	 */
+	RPOInstance *_instance;
+	unsigned _chunkSize;
+	vector<RPOSolution*> _chunks;
+	vector<RPOSolution*> _free;
+
+	/* Function which builds a new chunk of solutions and adds them to the free list */
+	void grow();
+
+	RPOSolutionPool(const RPOSolutionPool &);
+	RPOSolutionPool &operator=(const RPOSolutionPool &);
+
+public:
+	/**
+	 * Constructor
+	 * @param[in] instance Instance of the solutions
+	 * @param[in] chunkSize Number of solutions built at once when there are no free ones (the
+	 *                      number of solutions used at the same time, if it is known)
+	 */
+	RPOSolutionPool(RPOInstance &instance, unsigned chunkSize);
+
+	/**
+	 * Destructor. It destroys all the solutions of the pool
+	 */
+	~RPOSolutionPool();
+
+	/**
+	 * Function which returns a solution which is not being used, in the same state as a new one
+	 * (see RPOSolution::reset)
+	 */
+	RPOSolution *acquire();
+
+	/**
+	 * Function which returns a solution to the pool, so that it can be acquired again
+	 * @param[in] solution Solution acquired from the pool
+	 */
+	void release(Solution *solution){
+		_free.push_back((RPOSolution*) solution);
+	}
+
+	/**
+	 * Function which returns the number of solutions of the pool (used or not)
+	 */
+	unsigned getNumSolutions() const{
+		return (unsigned) (_chunks.size() * _chunkSize);
+	}
+};
+
+#endif
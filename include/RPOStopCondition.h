@@ -26,12 +26,14 @@ class RPOStopCondition{
 	 * _maxTime double indicating the maximum running time of the metaheuristic, measured in seconds
 	 * _numIterations unsigned It counts the number of iterations considered
 	 * _time Object of the Timer class which counts the running seconds of the metaheuristic
+	 * _context Evaluation context whose evaluations are counted (NULL for the context of the thread which checks the condition)
 	 */
 	unsigned _maxEvaluations;
 	unsigned _maxIterations;
 	double _maxTime;
 	unsigned _numIterations;
 	Timer _time;
+	RPOEvaluationContext *_context;
 
 public:
 	/**
@@ -42,6 +44,7 @@ public:
 		_maxIterations = 0;
 		_maxTime = 0;
 		_numIterations = 0;
+		_context = NULL;
 		_time.reset(); //Reset the variable _time calling to the proper method
 	}
 
@@ -53,7 +56,7 @@ public:
 	virtual bool reached(){
 		bool result = false;
 
-		if (_maxEvaluations > 0 && RPOEvaluator::getNumEvaluations() >= _maxEvaluations)
+		if (_maxEvaluations > 0 && getNumEvaluations() >= _maxEvaluations)
 			result = true;
 
 		if (_maxIterations > 0 && _numIterations >= _maxIterations)
@@ -78,6 +81,18 @@ public:
 		_time.reset(); //Reset the variable _time calling to the proper method
 	}
 
+	/**
+	 * Function which sets the evaluation context whose evaluations are counted
+	 * @param[in] context Context, or NULL for the context of the thread which checks the condition
+	 */
+	void setContext(RPOEvaluationContext *context){
+		_context = context;
+	}
+
+	unsigned long getNumEvaluations() const{
+		return (_context != NULL) ? _context->getNumEvaluations() : RPOEvaluator::getNumEvaluations();
+	}
+
 	unsigned int getIterarions(){
 		return _numIterations;
 	}
@@ -13,6 +13,7 @@
 
 #include <RPOSolution.h>
 #include <RPOInstance.h>
+#include <RPOBestTracker.h>
 #include <RPOMetaheuristic.h>
 #include <RPOStopCondition.h>
 #include <cstdlib>
@@ -38,12 +39,14 @@ protected:
 	 * _shortTermMem_aux this is a auxiliary structure to make more efficient checking if
 	 *                   an element is found in the tabu memory
 	 * _tabuTennure Tabu tennure of the metaheuristic
+	 * _bestTracker keeps _bestSolution without copying _solution in every improvement
 	 */
 	RPOSolution *_solution;
 	RPOInstance *_instance;
 	queue<unsigned> _shortTermMem;
 	set<unsigned> _shortTermMem_aux;
 	unsigned _tabuTennure;
+	RPOBestTracker _bestTracker;
 
 	/**
 	 * Vector of doubles with the quality of the last solution evaluated
@@ -90,6 +93,17 @@ public:
 	 */
 	virtual void run(RPOStopCondition &stopCondition);
 
+	/**
+	 * Function which returns the best solution found up to the moment, building it from the
+	 * current solution if the tracker is behind (see RPOBestTracker)
+	 * @return Best solution found up the moment
+	 */
+	virtual RPOSolution*& getBestSolution(){
+		if (_bestSolution != NULL)
+			_bestTracker.getSolution();
+		return _bestSolution;
+	}
+
 	/**
 	 * Function returning the array with the results of the solutions accepted, in each step,
 	 * by the metaheuristic
@@ -15,6 +15,10 @@
 #define MAX_SOLUTIONS_PER_RUN 100000
 #define NUM_RUNS 5
 #define MAX_INITIAL_SOLUTIONS 5
+#define FITNESS_CACHE_ENTRIES 0 //Solutions stored by the fitness cache (0 for not using it)
+#define FITNESS_CACHE_HITS_COUNT true //Whether a hit of the cache counts as an evaluation
+#define EVALUATION_PRECISION RPOInstance::ObjectiveType::PRECISION_DOUBLE //Precision of the evaluation (PRECISION_MIXED for single precision matrices)
+#define ROTATION_GROUP 0 //Size of the groups of the rotations of Func (0 for dense rotations)
 
 
 
@@ -33,6 +37,9 @@
 #include <RPOGeneticAlgorithm.h>
 #include <RPOAntColonyOpt.h>
 #include <RPOStopCondition.h>
+#include <RPOFitnessCache.h>
+#include <RPOEvaluationContext.h>
+#include <RPOProfiler.h>
 
 #include <cstdio>
 #include <cstdlib>
@@ -92,18 +99,37 @@ void free3Darray(vector< vector <vector<T>*>*> &array){
  * @param[in] instance Instance of the RPO
  */
 void runARandomSearchExperiment(vector<double> &results, RPOInstance &instance){
-
-	RPOSolution currentSolution(instance);
+	RPOEvaluationContext context; //Evaluations and cache of this run
+	RPOEvaluationContext::Scope scope(context);
+	RPO_PROFILE_RUN(CALLER_RS);
+	vector<RPOSolution*> solutions;
+	vector<double> fitness;
 	Timer t;
 	unsigned int numSolutions = 0;
 
-	//While there is time and not too many solutions have been generated, generate a random solution and store the result
+	unsigned int batchSize = instance.getBatchSize();
+
+	for (unsigned int i = 0; i < batchSize; i++)
+		solutions.push_back(new RPOSolution(instance));
+
+	//While there is time and not too many solutions have been generated, generate a block of random solutions,
+	//evaluate them together and store the results
 	while (t.elapsed_time(Timer::VIRTUAL) <= MAX_SECONS_PER_RUN && numSolutions < MAX_SOLUTIONS_PER_RUN){
-		RPOSolGenerator::genRandomSol(instance, currentSolution);
-		double currentFitness = instance.getFitness(currentSolution);
-		results.push_back(currentFitness);
-		numSolutions++;
+		unsigned int blockSize = min(batchSize, MAX_SOLUTIONS_PER_RUN - numSolutions);
+		while (solutions.size() > blockSize){
+			delete solutions.back();
+			solutions.pop_back();
+		}
+		for (RPOSolution *sol : solutions)
+			RPOSolGenerator::genRandomParameters(instance, *sol);
+		RPOEvaluator::computeFitnessBatch(instance, solutions, fitness);
+		for (double currentFitness : fitness)
+			results.push_back(currentFitness);
+		numSolutions += blockSize;
 	}
+
+	for (RPOSolution *sol : solutions)
+		delete sol;
 }
 
 void runALSExperiment(vector<double> &currentResults, vector<double> &bestSoFarResults, RPOInstance &instance, RPONeighExplorer &explorer) {
@@ -112,7 +138,9 @@ void runALSExperiment(vector<double> &currentResults, vector<double> &bestSoFarR
 	RPOLocalSearch ls;
 	RPOSolution initialSolution(instance);
 	Timer t;
-	RPOEvaluator::resetNumEvaluations();
+	RPOEvaluationContext context; //Evaluations and cache of this run
+	RPOEvaluationContext::Scope scope(context);
+	RPO_PROFILE_RUN(CALLER_LS);
 
 	//Generate a first random solution to initialize bestFitness
 	RPOSolGenerator::genRandomSol(instance, initialSolution);
@@ -207,7 +235,9 @@ void runASAExperiment(vector<double> &currentResults,
 	RPOSolution initialSolution(instance);
 	RPOSimulatedAnnealing sa;
 	RPOStopCondition stopCond;
-	RPOEvaluator::resetNumEvaluations();
+	RPOEvaluationContext context; //Evaluations and cache of this run
+	RPOEvaluationContext::Scope scope(context);
+	RPO_PROFILE_RUN(CALLER_SA);
 	sa.initialise(0.9, 10, 0.9999, 50, instance);
 	stopCond.setConditions(MAX_SOLUTIONS_PER_RUN, 0, MAX_SECONS_PER_RUN);
 
@@ -247,7 +277,9 @@ void runATSExperiment(vector<double> &currentResults,
 	RPOSolution initialSolution(instance);
 	RPOTabuSearch ts;
 	RPOStopCondition stopCond;
-	RPOEvaluator::resetNumEvaluations();
+	RPOEvaluationContext context; //Evaluations and cache of this run
+	RPOEvaluationContext::Scope scope(context);
+	RPO_PROFILE_RUN(CALLER_TS);
 	ts.initialise(&instance, ((unsigned)(instance.getNumParameters() / 2.5)));
 	stopCond.setConditions(MAX_SOLUTIONS_PER_RUN, 0, MAX_SECONS_PER_RUN);
 
@@ -287,7 +319,9 @@ void runAGraspExperiment(vector<double> &currentResults,
 	RPOSolution initialSolution(instance);
 	RPOGrasp grasp;
 	RPOStopCondition stopCond;
-	RPOEvaluator::resetNumEvaluations();
+	RPOEvaluationContext context; //Evaluations and cache of this run
+	RPOEvaluationContext::Scope scope(context);
+	RPO_PROFILE_RUN(CALLER_GRASP);
 	grasp.initialise(0.25, instance);
 	stopCond.setConditions(MAX_SOLUTIONS_PER_RUN, 0, MAX_SECONS_PER_RUN);
 
@@ -326,7 +360,9 @@ void runAIGExperiment(vector<double> &currentResults,
 	RPOSolution initialSolution(instance);
 	RPOIteratedGreedy ig;
 	RPOStopCondition stopCond;
-	RPOEvaluator::resetNumEvaluations();
+	RPOEvaluationContext context; //Evaluations and cache of this run
+	RPOEvaluationContext::Scope scope(context);
+	RPO_PROFILE_RUN(CALLER_IG);
 	ig.initialise(0.25, instance);
 	stopCond.setConditions(MAX_SOLUTIONS_PER_RUN, 0, MAX_SECONS_PER_RUN);
 
@@ -367,7 +403,9 @@ void runAGAExperiment(vector<double> &currentResults,
     //Initialization
     RPOGeneticAlgorithm ga;
     RPOStopCondition stopCond;
-    RPOEvaluator::resetNumEvaluations();
+    RPOEvaluationContext context; //Evaluations and cache of this run
+    RPOEvaluationContext::Scope scope(context);
+    RPO_PROFILE_RUN(CALLER_GA);
     ga.initialise(60, instance);
     stopCond.setConditions(MAX_SOLUTIONS_PER_RUN, 0, MAX_SECONS_PER_RUN);
 
@@ -407,7 +445,9 @@ void runAnACOExperiment(vector<double> &currentResults,
     //Initialization
     RPOAntColonyOpt* aco= new RPOAntColonyOpt();
     RPOStopCondition stopCond;
-    RPOEvaluator::resetNumEvaluations();
+    RPOEvaluationContext context; //Evaluations and cache of this run
+    RPOEvaluationContext::Scope scope(context);
+    RPO_PROFILE_RUN(CALLER_ACO);
     aco->initialise(10, 0.7, 0.1, 0.5, 10, 0.0000001, 4000, instance);
     stopCond.setConditions(MAX_SOLUTIONS_PER_RUN, 0, MAX_SECONS_PER_RUN);
     //Run the ACO
@@ -472,7 +512,16 @@ void runRandomExperiment(vector<double> &currentResults,
  */
 void runExperiments(vector< vector< vector< double>* >* > &results, int numfunc, vector<string>&methanames){
 	//Read the instance and create the data structures needed to store the results
+#if ROTATION_GROUP > 0
+	RPOInstance instance(50,numfunc,Func::DEFAULT_DATA_SEED,ROTATION_GROUP);
+#else
 	RPOInstance instance(50,numfunc);
+#endif
+	instance.setPrecision(EVALUATION_PRECISION);
+	RPOFitnessCache *cache = NULL;
+	if (FITNESS_CACHE_ENTRIES > 0)
+		cache = new RPOFitnessCache(FITNESS_CACHE_ENTRIES, FITNESS_CACHE_HITS_COUNT);
+	RPOEvaluator::setCache(cache);
 	//Random
 		methanames.push_back("RS");
         vector<double>*avCurr=new vector<double>;
@@ -580,6 +629,8 @@ void runExperiments(vector< vector< vector< double>* >* > &results, int numfunc,
         //resultsACO->push_back(antsMean);
         runAnACOExperiment(*theseResults, *bestResults, *bestPerIterations,*antsMean, instance);
     //cout << endl;
+	RPOEvaluator::setCache(NULL);
+	delete cache;
 }
 
 /**
@@ -705,5 +756,6 @@ int main() {
 		//////////////////////
 		free3Darray(allTheResults);
 	}
+	RPO_PROFILE_DUMP();
 	return 0;
 }
@@ -0,0 +1,190 @@
+/**
+ * FuncAccuracyTest.cpp
+ *
+ * Test which checks the fitness of the 28 functions against the original scalar implementation
+ * of CEC 2013 (see FuncReference.h), in all the ways an instance evaluates a solution: from
+ * scratch, in blocks (fitnessBatch), and after changing one parameter incrementally
+ * (fitnessDelta and fitnessSweep).
+ *
+ * The relative difference (over the larger of 1 and the reference) has to be below TOLERANCE.
+ * The full evaluations differ from the reference in the order of some sums and, with the
+ * elementary functions of FuncMath (the default, see FuncKernels), in the last bits of the
+ * sines, cosines and powers. The changes of a parameter also use a first rotation updated
+ * incrementally, whose last bits differ from those of the full product. The largest differences,
+ * about 5e-11 with both FuncMath and the C library (FUNC_MATH=libm) at D=100, are those of
+ * Schaffer F7 (7) and of the composition function 8 (28), which take powers and sines of the
+ * rotated values. Rotated Ackley (8), far more sensitive, is always evaluated from scratch with
+ * the C library (see Func::_fullDelta), so it matches the reference.
+ *
+ * It also makes a walk of changes in every function and dimension, as the metaheuristics do, and
+ * compares each incremental evaluation with the full evaluation of the same solution. Along a walk
+ * the first rotation accumulates up to D updates before it is computed again (see
+ * Func::syncState), and the functions 7 and 28 amplify the differences of its last bits: they
+ * reach about 2.5e-10 in these walks, and 1e-9 in longer random walks at D=50. Computing the
+ * rotation again more often does not bring them below 1e-10 (a single update from a fresh state
+ * already differs by 1.5e-10 in some solutions), so the walks have their own WALK_TOLERANCE.
+ *
+ * It is run from the directory which contains input_data, and it can be repeated with each
+ * instruction set (FUNC_KERNELS) and with FUNC_MATH=libm. From the root of the repository:
+ *   g++ -std=c++17 -O2 -Iinclude tests/FuncAccuracyTest.cpp RPOInstance.cpp RPOSolution.cpp -o FuncAccuracyTest
+ *   ./FuncAccuracyTest
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#include <RPOInstance.h>
+#include <RPOSolution.h>
+#include "FuncReference.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdint.h>
+#include <vector>
+
+using namespace std;
+
+#define TOLERANCE 1e-10 //Largest relative difference of an evaluation from the reference
+#define WALK_TOLERANCE 3e-9 //Largest relative difference of an incremental evaluation from the full one, in a walk
+#define WALK_STEPS 3 //Length of the walks, in changes per parameter (the state is computed again every D updates)
+
+/**
+ * Function which builds the solution number s of the test of the function fn with D parameters,
+ * and the parameter and the value of its change. The first three solutions are the centre of the
+ * search space and its two corners, and the rest are pseudorandom (the same in every platform,
+ * as they are the ones of the reference values).
+ */
+static void buildsolution(int fn, int D, int s, vector<int> &parameters, int &indexParam, int &newValue){
+	uint64_t state=1000003ULL*fn+1009ULL*D+s;
+	parameters.resize(D);
+	for (int i=0; i<D; i++)
+	{
+		state=state*6364136223846793005ULL+1442695040888963407ULL;
+		int random=(int) ((state>>33)%201);
+		parameters[i]=(s==0)?100:(s==1)?0:(s==2)?200:random;
+	}
+	state=state*6364136223846793005ULL+1442695040888963407ULL;
+	indexParam=(int) ((state>>33)%D);
+	state=state*6364136223846793005ULL+1442695040888963407ULL;
+	newValue=(int) ((state>>33)%201);
+}
+
+/* Relative difference between a fitness and its reference */
+static double difference(double fitness, double reference){
+	return fabs(fitness-reference)/max(1.0, fabs(reference));
+}
+
+/**
+ * Function which makes a walk of WALK_STEPS*D changes of one parameter from the solution
+ * REFERENCE_SOLUTIONS-1, applying each change as the metaheuristics do (the fitness of the
+ * incremental evaluation is assigned, and the state is updated in the next change). It returns the
+ * largest relative difference of the incremental evaluations (fitnessDelta and fitnessSweep) from
+ * the full evaluation of the same solution.
+ */
+static double walkdifference(RPOInstance &instance, int fn, int D){
+	vector<int> parameters;
+	vector<double> sweepFitness;
+	int indexParam, newValue;
+	double worst=0;
+	buildsolution(fn, D, REFERENCE_SOLUTIONS-1, parameters, indexParam, newValue);
+	RPOSolution sol(instance), changed(instance);
+	for (int i=0; i<D; i++)
+		sol.ChangeParameterTo(i, parameters[i]);
+	sol.setFitness(instance.getFitness(sol));
+
+	uint64_t state=7919ULL*fn+D;
+	for (int step=0; step<WALK_STEPS*D; step++)
+	{
+		state=state*6364136223846793005ULL+1442695040888963407ULL;
+		indexParam=(int) ((state>>33)%D);
+		state=state*6364136223846793005ULL+1442695040888963407ULL;
+		newValue=(int) ((state>>33)%201);
+
+		double delta=instance.getFitness(sol, indexParam, newValue);
+		instance.getFitnessSweep(sol, indexParam, sweepFitness);
+		changed.copy(sol);
+		changed.ChangeParameterTo(indexParam, newValue);
+		double full=instance.getFitness(changed);
+		worst=max(worst, max(difference(delta, full), difference(sweepFitness[newValue], full)));
+
+		sol.ChangeParameterTo(indexParam, newValue);
+		sol.setFitness(delta);
+	}
+	return worst;
+}
+
+int main(){
+	int numFailures=0;
+
+	for (int fn=1; fn<=28; fn++)
+	{
+		double worst=0, worstWalk=0;
+
+		for (int d=0; d<(int) (sizeof(REFERENCE_DIMENSIONS)/sizeof(REFERENCE_DIMENSIONS[0])); d++)
+		{
+			int D=REFERENCE_DIMENSIONS[d];
+			RPOInstance instance(D, fn);
+			vector<RPOSolution*> solutions;
+			vector<double> batchFitness, sweepFitness;
+
+			for (int s=0; s<REFERENCE_SOLUTIONS; s++)
+			{
+				vector<int> parameters;
+				int indexParam, newValue;
+				buildsolution(fn, D, s, parameters, indexParam, newValue);
+				RPOSolution *sol=new RPOSolution(instance);
+				for (int i=0; i<D; i++)
+					sol->ChangeParameterTo(i, parameters[i]);
+				solutions.push_back(sol);
+
+				const double *reference=REFERENCE_FITNESS[fn-1][d][s];
+				instance.getFitnessSweep(*sol, indexParam, sweepFitness);
+				double errors[3]={difference(instance.getFitness(*sol), reference[0]),
+					difference(instance.getFitness(*sol, indexParam, newValue), reference[1]),
+					difference(sweepFitness[newValue], reference[1])};
+				const char *names[3]={"full", "delta", "sweep"};
+
+				for (int k=0; k<3; k++)
+				{
+					worst=max(worst, errors[k]);
+					if (!(errors[k]<=TOLERANCE))
+					{
+						printf("FAILED: function %d, D=%d, solution %d, %s evaluation: relative difference %g\n", fn, D, s, names[k], errors[k]);
+						numFailures++;
+					}
+				}
+			}
+
+			instance.getFitness(solutions, batchFitness);
+			for (int s=0; s<REFERENCE_SOLUTIONS; s++)
+			{
+				double error=difference(batchFitness[s], REFERENCE_FITNESS[fn-1][d][s][0]);
+				worst=max(worst, error);
+				if (!(error<=TOLERANCE))
+				{
+					printf("FAILED: function %d, D=%d, solution %d, batch evaluation: relative difference %g\n", fn, D, s, error);
+					numFailures++;
+				}
+				delete solutions[s];
+			}
+
+			double error=walkdifference(instance, fn, D);
+			worstWalk=max(worstWalk, error);
+			if (!(error<=WALK_TOLERANCE))
+			{
+				printf("FAILED: function %d, D=%d, walk of incremental evaluations: relative difference %g\n", fn, D, error);
+				numFailures++;
+			}
+		}
+
+		printf("Function %2d: largest relative difference %g from the reference, %g in the walks\n", fn, worst, worstWalk);
+	}
+
+	if (numFailures>0)
+	{
+		printf("%d evaluations differ by more than %g from the reference, or by more than %g in a walk\n", numFailures, TOLERANCE, WALK_TOLERANCE);
+		return 1;
+	}
+	printf("All the evaluations are within %g of the reference, and within %g in the walks\n", TOLERANCE, WALK_TOLERANCE);
+	return 0;
+}
@@ -0,0 +1,337 @@
+/**
+ * FuncReference.h
+ *
+ * Reference values of the test FuncAccuracyTest: the fitness of the solutions of the test (see
+ * buildsolution in FuncAccuracyTest.cpp), computed with the original scalar implementation of
+ * the CEC 2013 functions (Func before the vector kernels, with the C library), reading the data
+ * files of input_data.
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#ifndef TESTS_FUNCREFERENCE_H
+#define TESTS_FUNCREFERENCE_H
+
+/* Dimensions of the reference values */
+static const int REFERENCE_DIMENSIONS[4] = {10, 30, 50, 100};
+
+/* Number of solutions of each function and dimension */
+#define REFERENCE_SOLUTIONS 8
+
+/**
+ * REFERENCE_FITNESS[fn-1][d][s] Fitness of the solution s of the function fn with the dimension
+ * REFERENCE_DIMENSIONS[d], before and after the change of one of its parameters
+ */
+static const double REFERENCE_FITNESS[28][4][REFERENCE_SOLUTIONS][2] = {
+	/* Function 1 */
+	{
+		{{-22372.603612784849, -21650.740740495836}, {-172162.96897337076, -155951.79173963668}, {-72582.238252198949, -70405.429810657297}, {-82750.792147493674, -74757.858107822583},
+		 {-65888.543901594327, -65498.801420381584}, {-37247.286836309031, -26789.887713479322}, {-39612.396278047658, -38513.999091894868}, {-79385.136841223604, -64490.564102525459}},
+		{{-61114.866507034909, -62649.473058494739}, {-466314.38612254435, -455639.96970787528}, {-255915.34689152549, -248786.8314250111}, {-187603.57438796526, -187564.00571405917},
+		 {-123873.95954743688, -131770.39114600731}, {-199477.07930551245, -208284.21610837159}, {-164696.94187160791, -167462.43006205189}, {-93240.532372412825, -94042.657285289111}},
+		{{-118871.11074889658, -117700.33834109484}, {-703286.04444748792, -697695.40302224539}, {-534456.17705030506, -532493.85163451196}, {-300755.33784376836, -301527.84130151715},
+		 {-210369.79561974495, -205832.7119122814}, {-288538.23589454655, -285409.54690123489}, {-210023.1859819431, -209438.14336024923}, {-280792.36449029378, -272380.93277196307}},
+		{{-261460.930456648, -258768.94097895906}, {-1343971.3840015398, -1344075.9885778285}, {-1178950.4769117557, -1185056.39640185}, {-534347.19065144926, -556703.04050557932},
+		 {-529441.55972225778, -537246.36023813358}, {-650938.24381742603, -655475.49384381529}, {-705582.75777089922, -708428.96745504159}, {-636853.31190663879, -632253.04133441974}}
+	},
+	/* Function 2 */
+	{
+		{{-1588738946.1163497, -1649135611.0576129}, {-13448361105.807934, -16475225539.292692}, {-1442640298.9803917, -1954386337.1419988}, {-3078638195.0849442, -2812519848.2904558},
+		 {-12659693270.48127, -14478109823.976517}, {-1678343310.8951111, -1745414315.5045338}, {-547031365.42365634, -200765869.1878683}, {-7838209334.2514391, -8690635546.5658855}},
+		{{-3478321456.3738432, -6270374038.4052372}, {-20106968188.804756, -16746035156.97958}, {-6795713474.1755638, -8521341390.1826763}, {-7620256106.3284779, -9111227549.7588253},
+		 {-31080020340.273102, -31749697817.920219}, {-20660184397.615463, -19625942697.132343}, {-11888686436.456696, -10559606539.048603}, {-3010815475.2318888, -2815125088.0363536}},
+		{{-8943054872.1655369, -11798976873.891455}, {-25217714539.77129, -24496513883.826099}, {-33785230031.524734, -36950167130.805}, {-6624351785.5216198, -6560669928.2561054},
+		 {-31645081608.59483, -32820320845.692974}, {-20604454843.69656, -22677871131.140102}, {-20259743226.155636, -21657827292.880821}, {-15803934637.904951, -15510701444.900707}},
+		{{-14402477557.052416, -13641223736.623199}, {-105122293874.87228, -105122293874.87228}, {-73682190199.636002, -73560749978.107605}, {-34120370734.933781, -34808392432.937653},
+		 {-57534662661.238914, -59835707425.941956}, {-31955585977.655746, -31149386138.427841}, {-45436008479.865807, -45370169678.61985}, {-58569541512.018288, -60052650756.045891}}
+	},
+	/* Function 3 */
+	{
+		{{-4.0795268284108484e+21, -8.2336403563711362e+21}, {-1.4300151053181332e+35, -2.7322902515113154e+36}, {-12591832268109228, -1311283280156531}, {-4.0837248731906093e+28, -6.694521324998544e+28},
+		 {-1.1075788742245005e+30, -7.4186098766858464e+30}, {-1.5317030115778442e+18, -2.576559120818823e+21}, {-7.2390275034494298e+20, -1.4479904191220224e+18}, {-1.3932507463151536e+23, -5.6637817250935346e+21}},
+		{{-7.852428497355583e+20, -3.0042172365216772e+21}, {-4.3058108935008028e+39, -1.3418279510712246e+41}, {-1.1152438502572062e+28, -4.4458294466088885e+28}, {-1.0156896246418276e+26, -1.9296349533776386e+22},
+		 {-1.0191490040413485e+24, -3.0632366512202749e+24}, {-5.2179028770142059e+38, -4.3202149596111933e+38}, {-1.0382829988857223e+28, -2.3133466470602945e+28}, {-2.0286214267488912e+30, -4.9066065775462371e+31}},
+		{{-2.6783602726541756e+29, -9.2568249367407164e+29}, {-1.6257006459543388e+32, -6.1695550911445125e+31}, {-2.6701737081291428e+33, -1.4969734512888734e+31}, {-4.3383558881629801e+37, -2.655034455305058e+37},
+		 {-7.9373671212880574e+33, -9.4082707007467426e+33}, {-5.086267753994705e+35, -6.6537816393542423e+36}, {-2.9614657632528836e+44, -2.2613892586780952e+44}, {-4.0974731548841495e+24, -9.8774002681500216e+24}},
+		{{-3.8114684746440011e+27, -1.7774049622596278e+28}, {-5.7267601947772838e+45, -3.0110608495661739e+46}, {-3.3528799105948662e+36, -1.8009971061568088e+37}, {-6.1650976896219766e+35, -2.655610430410652e+35},
+		 {-2.7888077515668656e+33, -6.413803266407487e+34}, {-1.9154364406567301e+30, -1.5395669455298441e+30}, {-2.3921825449208438e+32, -2.9440020108938929e+32}, {-6.3091613653027739e+33, -4.8604942929887606e+32}}
+	},
+	/* Function 4 */
+	{
+		{{-64005654.028952934, -37472.348047707783}, {-9323565347.0327282, -22832815658.92881}, {-11356586748.070807, -16764854311.736649}, {-11236614420.849947, -5283172931.813653},
+		 {-3451559759.2615042, -3853257382.907393}, {-1267293498.9971676, -4898584542.6978493}, {-377275657.9156034, -3028058410.4285965}, {-3346095292.4287925, -3115178171.0408535}},
+		{{-159350432.35254702, -50316628.125997275}, {-8452223926.7504454, -5936243780.1130972}, {-4431991919.9984379, -5254880388.3546419}, {-763606311.63634622, -748052363.49581563},
+		 {-214228652.15127185, -204935312.99259531}, {-6629642794.8548765, -8586232861.9707413}, {-10005387970.339645, -9876776652.3424397}, {-2708328953.3125811, -2676977872.5670981}},
+		{{-275279460.3078382, -273369005.83976346}, {-7906171749.439023, -5693015773.4368553}, {-13719235122.233351, -19307813544.461674}, {-11784694075.195023, -14717667390.84156},
+		 {-822138592.20631909, -883199756.52483547}, {-2700878659.3708525, -2358281911.9320354}, {-8658778.8537767027, -9097730.2767000496}, {-4045937711.2066202, -4556290741.1608572}},
+		{{-1169744009.5698092, -397509279.54679567}, {-3803314332.5688958, -4143618247.5337734}, {-19493030502.198849, -24413156459.684322}, {-4516152780.0710907, -2926925146.0571218},
+		 {-4142551955.5454764, -4008453114.5541358}, {-614951530.8792336, -470777772.09308261}, {-3479744328.5262203, -1979196053.1937876}, {-24880115884.017876, -24173404918.795704}}
+	},
+	/* Function 5 */
+	{
+		{{-397498.65403365623, -397498.65232297237}, {-5219113.844799513, -5219113.8428299995}, {-426408.09371218394, -426408.09007424553}, {-241519.20608577953, -241519.20595523747},
+		 {-1192537.90737739, -1192537.9060700922}, {-3206109.4075548588, -3206109.4053611024}, {-393171.74286795722, -393171.73777239345}, {-2175419.4513008697, -2175419.4513267307}},
+		{{-331951.70218027645, -331951.70117933501}, {-4859944.1317380099, -4859944.1300703427}, {-416096.68374874606, -416096.68026212853}, {-242127.97038409885, -242127.97275502456},
+		 {-272875.5413049201, -272875.54214377026}, {-95478.06735158652, -95478.083517670268}, {-878005.09255788487, -878005.08568674291}, {-1571637.0621417991, -1571637.0713030274}},
+		{{-259874.1182451382, -259882.26633284707}, {-4333091.7641722299, -4333091.7639165604}, {-843184.2142568155, -842859.4539973794}, {-485633.78877097822, -485633.78688284231},
+		 {-398840.01389397576, -398987.9975817232}, {-497627.58364821121, -497627.57816808671}, {-2885512.3098314162, -2885519.7731658202}, {-188802.4047918795, -188802.42856326085}},
+		{{-280820.20806089049, -280639.47777427617}, {-1082799.4741823135, -1082799.4691500366}, {-4407410.1426975727, -4407410.1424714625}, {-1252198.501276993, -1252198.5022818982},
+		 {-675437.99883505155, -675438.15748474549}, {-2910037.3182413769, -2910037.0235888553}, {-801152.91734446923, -801152.21085580357}, {-656292.2346267231, -656283.72310112335}}
+	},
+	/* Function 6 */
+	{
+		{{-7062.4369374337484, -9301.0380775105496}, {-142081.81362780038, -173884.09357793108}, {-40933.225955042421, -32958.385005395481}, {-26216.780990824685, -28681.740382865395},
+		 {-102308.04772762285, -101172.44891782047}, {-6011.1819094441125, -6805.596954003855}, {-105887.99448958877, -90182.779924079645}, {-39702.632178473315, -38219.338135905535}},
+		{{-16331.598024258547, -17078.053090740526}, {-631446.75963398791, -506808.08982167067}, {-202419.07570672565, -202143.83548218352}, {-74477.96305251203, -76352.875114917537},
+		 {-81338.36906991477, -86799.355596450841}, {-66669.210729839004, -68104.269860327782}, {-99932.993292061161, -102553.50386544489}, {-82965.939676058828, -52518.375086882057}},
+		{{-36204.87415139212, -35775.1418561705}, {-504207.53925443813, -450289.30671708059}, {-419673.53309011523, -382178.59977578151}, {-121302.06231488119, -112115.61204278553},
+		 {-152063.18767574607, -134505.91766108407}, {-188478.38503788272, -170954.22382939639}, {-166873.83442208459, -162320.72610149832}, {-105495.32715884996, -107025.77880171995}},
+		{{-98079.493637953114, -106913.30323759967}, {-1147520.4539779311, -1131236.5275619521}, {-722050.45632758748, -734077.08365177433}, {-349244.37305669807, -367494.16450068459},
+		 {-374079.39312140271, -374115.56111004605}, {-262245.93988821062, -268257.49247652473}, {-295152.61287368834, -275949.31241209368}, {-328108.37711343175, -331722.82442039903}}
+	},
+	/* Function 7 */
+	{
+		{{-99330273.295940533, -227255339.99134809}, {-669596526447721.88, -1047261806764649.1}, {-165002.29432905561, -37450.268971254613}, {-2787598871282924, -126188822335750.25},
+		 {-32023958542613.758, -13745671655.557474}, {-1588809395998.7917, -2588597660527.3579}, {-580378487707.16919, -210647017.81870058}, {-686094777818.23486, -206745918250.11334}},
+		{{-41744629.733089045, -11211739198.502489}, {-76723319254292432, -98900075903261136}, {-130143308543.9894, -827526115.40786314}, {-40690134201.163055, -37907227363.28801},
+		 {-2758464623847.1592, -612456269910.45862}, {-1869027456066.158, -1632793267569.8804}, {-175614822691884.19, -93294389126156.859}, {-1233691699.8538668, -4498056314.6483393}},
+		{{-522585805440.43524, -5835112421856.4404}, {-11774612640408.072, -7851275360894.9873}, {-46688071799489.695, -70673915191300.438}, {-1842116417065769.5, -29629220935833708},
+		 {-574867385541.18921, -741934639975.51978}, {-6.1215127340910956e+20, -1.8637922912513609e+20}, {-2258760440.7857337, -4477891843.4486923}, {-6607714660897.3359, -10305042264487.967}},
+		{{-45120024386.192856, -46503077149.834869}, {-5.7110180863204327e+19, -7.0291950706886623e+19}, {-1554953308156494, -2318531812024194.5}, {-2517150544270563, -167031586549902.78},
+		 {-3836091776621463, -3468607395329960.5}, {-1612696778727.4819, -1464554340955.0403}, {-164998881547.19141, -627517233765.43408}, {-10277951917376824, -11274973265967316}}
+	},
+	/* Function 8 */
+	{
+		{{678.03081110275434, 678.5642032794384}, {678.45070971926316, 678.41224117933075}, {678.49976082764761, 678.40456720690668}, {678.30498758591989, 677.9435320454478},
+		 {678.70934683837993, 678.11873329675097}, {678.10044685561672, 678.43321137057239}, {678.14943946497056, 677.99529798181663}, {678.1835738221165, 678.63056187261782}},
+		{{678.40584529990417, 678.24260416359152}, {677.98734116758669, 678.21618895609402}, {678.18791730054818, 678.04920800995762}, {678.38170744094964, 678.26318216045547},
+		 {678.33000457732157, 678.4063924278978}, {678.24905498070268, 678.36944618817313}, {678.25935042510685, 678.37506910339255}, {678.220985775754, 678.41277897783846}},
+		{{678.30261513354094, 678.17858379738391}, {678.22789365956589, 678.32280519951667}, {678.54797055576694, 678.42991382169407}, {678.3794139040117, 678.27332903322656},
+		 {678.24274835938036, 678.39695466468652}, {678.17739074134033, 678.19602622526725}, {678.18138251079802, 678.21572916742059}, {678.23436294081182, 678.25047372844006}},
+		{{678.24012786070386, 678.35321829108454}, {678.36050583946599, 678.27956335136992}, {678.2217545748872, 678.32966341991539}, {678.40795073142237, 678.21224431552355},
+		 {678.0767513508099, 678.27739769410141}, {678.24068258410432, 678.30640954031117}, {678.24996161300498, 678.23141125155109}, {678.3789302658771, 678.35457551188233}}
+	},
+	/* Function 9 */
+	{
+		{{577.50561669324463, 581.36149216656736}, {585.67210188793547, 578.56637520216952}, {578.12563882091411, 578.22154142216903}, {578.19665315377972, 581.60679555330489},
+		 {582.42156545403498, 577.784682121233}, {580.26023634893966, 581.16678951383244}, {577.63444969407135, 574.45201530781753}, {577.17093535311744, 578.4449768533251}},
+		{{536.56821727009776, 536.65200340282502}, {542.30717270946377, 538.68759700226565}, {540.15849861890774, 541.72246691548708}, {546.87023010472728, 553.45998582630943},
+		 {542.84595060524532, 543.2396832714594}, {539.28695384989669, 538.13242647650634}, {539.20101756550025, 538.50109435919205}, {548.65638625173199, 545.39445985226428}},
+		{{502.98529570517883, 503.99173095055312}, {505.31838927605111, 500.56822031899503}, {496.37665459550897, 494.90024898487712}, {493.02869547909484, 491.56675819548974},
+		 {505.52913407880465, 496.0974104118352}, {495.57821675327546, 492.54925906836775}, {496.16348223457578, 501.86040363907074}, {499.69619357194267, 503.32938453700336}},
+		{{409.18744649709879, 405.93390186612072}, {389.53166598561347, 413.45804307843412}, {392.78206863217628, 400.82671336388705}, {397.18477532538435, 403.94859433760814},
+		 {409.62480019025679, 404.79850966185381}, {402.07864891325266, 399.82849946469787}, {398.41048949419701, 401.30971492041351}, {407.71496434240839, 402.35518333348193}}
+	},
+	/* Function 10 */
+	{
+		{{-3585.5628886211553, -3365.1207846131961}, {-37422.54755814212, -36919.089923362677}, {-6235.9012059585039, -6684.9284105825664}, {-5521.9427069001531, -5280.4322139030292},
+		 {-7488.9337581944073, -7567.4050005958316}, {-12956.873904698403, -18585.304116307398}, {-9245.7286763470311, -19161.830326474279}, {-10071.776791410673, -10658.439999972501}},
+		{{-7218.2812113136479, -7662.7014040656759}, {-55149.379440210163, -47940.957846925223}, {-33920.099782140693, -32712.053753962951}, {-17648.125105191641, -14790.066626851733},
+		 {-45725.028806679766, -47785.659977461008}, {-36921.208867416026, -37253.237038895473}, {-38369.008241070442, -36902.368905685413}, {-28404.906851042968, -29449.174426021604}},
+		{{-23614.565084332713, -23667.378215199355}, {-108360.88596855928, -108191.85762966878}, {-98565.818245341958, -87916.392414079717}, {-66487.886081184639, -66948.476335160798},
+		 {-50162.974675657482, -50561.880342961951}, {-88612.3109128941, -87076.473009734531}, {-28104.274818125377, -30251.189436645793}, {-36507.46173819757, -37195.672793865007}},
+		{{-47625.717019150718, -46034.822067275272}, {-260369.53392495948, -262651.53256066539}, {-188030.26179153178, -188595.51736686268}, {-121331.85173102602, -124358.07273998301},
+		 {-148193.23160029005, -141964.90931004789}, {-70906.33318236754, -72109.276836869147}, {-123809.65684050821, -124813.22865371739}, {-103594.54967787367, -103174.73594765824}}
+	},
+	/* Function 11 */
+	{
+		{{-158.59585600847618, -679.53158751745082}, {-1485.7148140511556, -711.13799064236287}, {-6861.0818268944668, -6870.2939737681027}, {-253.56835881002553, 156.30294324052713},
+		 {-646.55920696021576, -627.86294240040706}, {-82.731872672979023, 25.572272533111118}, {-398.12893995875152, 211.7018168338904}, {-2513.123130848051, -2446.8090317364949}},
+		{{-773.03061937096868, -978.95621076189445}, {-4573.4883229108755, -4505.5535277820527}, {-13444.12169990369, -13597.652800049969}, {-4576.5810371632779, -4283.541845715481},
+		 {-2891.5956428087711, -2818.6298000646484}, {-1097.5019579988993, -1241.2714902203084}, {-4835.5575625047541, -5657.1551757347252}, {-1799.5315827716481, -2139.1802483836564}},
+		{{-2189.5302353100133, -2194.7849495746455}, {-6668.8453048529009, -6588.3124445173435}, {-41020.746311542185, -40975.45096500605}, {-7898.8398882559522, -7946.7921207604668},
+		 {-4443.7306207941147, -4454.9797066401679}, {-6030.2863855964042, -6016.8928332168352}, {-13568.850704883889, -13540.602216889782}, {-6746.8939053853319, -6752.806883248224}},
+		{{-4672.7662592130073, -4713.6203816761454}, {-14009.035395647252, -14124.376768254388}, {-72133.708261955733, -72145.277011730592}, {-11422.688150031659, -11312.178302374963},
+		 {-13427.565432490066, -13460.340526440446}, {-16577.315220652297, -16633.41582271022}, {-12096.454516784463, -12081.202017595131}, {-10022.866406090807, -10012.559928183371}}
+	},
+	/* Function 12 */
+	{
+		{{-127.19470177059213, 7.8365412804366201}, {-6558.3340239334739, -3673.1120695428035}, {-1061.0262470590988, -1067.2638225157762}, {-585.198759898812, -619.23404344382732},
+		 {-963.67776774419121, -646.09092602262365}, {-1728.8993224390497, -616.60510690258752}, {-303.69760019530838, 56.022383001584558}, {-5108.0608956977321, -2263.2394106441852}},
+		{{-881.71348937061475, -932.81827647288696}, {-16851.621162725354, -15749.069846725331}, {-4513.7362877532632, -4178.3419879189787}, {-5576.8373451549032, -5458.7156420200399},
+		 {-2244.7315782678579, -2087.5387352245039}, {-7625.2597633934238, -7251.4611900474974}, {-2623.1681847999603, -2710.1104682169239}, {-6355.4560425193367, -6344.9178659205072}},
+		{{-1910.4578158960117, -1961.9895985886187}, {-18569.918514771311, -19420.302752653195}, {-15477.079516961947, -15820.373516105297}, {-4645.4758697464194, -4905.8725091273454},
+		 {-11852.979870223111, -11150.73805208548}, {-4325.7466805323647, -4926.774696942548}, {-4741.5478144019371, -4708.0877879813988}, {-5945.3808974722506, -6265.3838646654422}},
+		{{-4839.4870099848486, -4832.512720660704}, {-56228.075641215655, -56466.558467247211}, {-26528.510186627576, -26812.996828525884}, {-11933.066340691863, -13136.851455020555},
+		 {-22800.111307467349, -23123.837166153946}, {-11634.902801750251, -11714.014770164984}, {-8681.9119736411049, -9016.1570960953177}, {-12649.222782710362, -11116.95016974984}}
+	},
+	/* Function 13 */
+	{
+		{{-242.88483457547062, -117.13756484433719}, {-6381.3911845226812, -3801.5376446637465}, {-1169.6711846560381, -1113.7540052107154}, {-1306.2324120931114, -1312.0493522068721},
+		 {-2876.2640754690347, -2273.2951499325859}, {-1935.5261138121646, -1705.6017073441903}, {-490.36296064625344, -470.05174094225436}, {-2267.8834548205068, -1673.6079328900719}},
+		{{-896.80315308498894, -992.69766109782586}, {-16781.775464613384, -15626.039049082325}, {-4766.0952443498491, -4683.0948444332853}, {-2536.9516765350891, -2565.9120940129774},
+		 {-6406.8799290062088, -3832.4975442643617}, {-2323.3043845313482, -2324.6244659698955}, {-6129.1012489554178, -7907.5461956152321}, {-3676.0713777366805, -3752.9696132882918}},
+		{{-2004.082003377418, -1988.2968154629402}, {-18548.704577746081, -17653.617333909508}, {-15711.298004142987, -15328.582553955761}, {-6409.6412259651715, -5797.5230891930378},
+		 {-4278.6284307944688, -4554.4341749441337}, {-3837.0269944892189, -3665.5620526241773}, {-5941.3927899312821, -5610.5097180844587}, {-7755.4230422934206, -8030.892519792882}},
+		{{-4879.9782154062268, -4889.825659416957}, {-55288.837587222137, -62959.784889178009}, {-26249.830733739036, -24575.628485484103}, {-14094.494507615287, -13898.733891249347},
+		 {-12204.032985480915, -14944.868973839046}, {-9457.5521080530143, -10096.072234595609}, {-14930.843823423129, -15430.132472465391}, {-16186.019195029516, -16169.150230463505}}
+	},
+	/* Function 14 */
+	{
+		{{-2964.0963944948085, -3088.2741036411826}, {-4628.9912397726375, -4648.2396016405346}, {-3334.9910891693244, -3217.6230705094181}, {-3609.5844622662094, -3429.713703801408},
+		 {-4542.3846603088505, -4475.1035822035801}, {-4220.2258926002933, -4644.7573798349877}, {-3715.8104054273867, -3935.3609652469841}, {-4331.4172859956971, -4006.7351357969383}},
+		{{-13579.713605243074, -13324.116380481619}, {-14977.797171848873, -14494.134385761829}, {-13347.508302755581, -13349.090030033669}, {-12040.801448881786, -11866.797376208893},
+		 {-12670.322576730043, -12477.700193411465}, {-13774.366159040872, -13873.86181640932}, {-12434.034157687538, -12685.048804175567}, {-12003.432336134716, -11744.625855362283}},
+		{{-20102.933681194019, -19684.100534798079}, {-21778.78580233239, -22235.327270746602}, {-18892.745635872758, -19053.205364257232}, {-19036.305541169033, -19219.029655632887},
+		 {-21947.474073478774, -22145.7384738484}, {-20241.209923545837, -20139.75851207905}, {-20538.31753223906, -20261.043185067196}, {-20795.237640666408, -20858.263356865205}},
+		{{-43174.913810067235, -43017.072597427665}, {-47732.044390322997, -47753.601217685042}, {-40413.549566691741, -41115.327311153516}, {-40560.581649156637, -40802.857594545399},
+		 {-40996.341378416357, -40776.817603386371}, {-38254.368071037417, -38775.897210122224}, {-44972.397677149092, -44978.04033862146}, {-40845.60614347706, -41263.906751321039}}
+	},
+	/* Function 15 */
+	{
+		{{-3841.4754727716536, -3927.4760722016176}, {-4922.3715878585235, -6229.6670918638074}, {-5716.005674420544, -4114.2846101366013}, {-4197.7179183697763, -3640.8639494304402},
+		 {-3749.4547934671882, -5267.7188166876385}, {-3289.3050732826605, -4643.7255649319131}, {-3917.7589713481357, -3917.7589713481357}, {-3765.9049228267659, -4065.0433222044649}},
+		{{-11836.09050059356, -12326.107865578897}, {-11829.543254939279, -13420.075170350963}, {-12037.399806671227, -13719.552820413634}, {-12999.835361184922, -13025.923019678559},
+		 {-12828.970875823959, -13696.799252992183}, {-12552.186635997437, -12120.127467846498}, {-11394.80103949914, -10633.451840933503}, {-13053.924083931832, -11719.184432665241}},
+		{{-18066.435278974277, -22065.409791398954}, {-21674.164835679207, -22529.100755946791}, {-23900.143768808935, -20277.368561462736}, {-21666.446784903655, -20467.480466136178},
+		 {-23197.47632492266, -20045.457732328057}, {-20005.363119565634, -20005.363119565634}, {-23570.829749525488, -21180.6793096863}, {-21748.292728913417, -18625.143785692482}},
+		{{-38653.345492860091, -38914.70795296094}, {-39124.76905935946, -40131.411202949916}, {-43683.10598085625, -43004.50019454983}, {-37589.578655584439, -41422.214877797254},
+		 {-38686.204677551767, -40501.678012536075}, {-40934.318540505104, -42251.36016670039}, {-38370.735120333382, -42083.429427983108}, {-38876.681497935926, -41179.423344848285}}
+	},
+	/* Function 16 */
+	{
+		{{-227.00412192207895, -212.09260940857254}, {-221.7953097102604, -225.55477133327037}, {-214.1258861032733, -214.70512972855715}, {-212.30579348225729, -210.71965892208195},
+		 {-218.34911946439141, -217.81572376514433}, {-230.5948546831093, -231.09675934745002}, {-224.87773228760884, -211.70766793894157}, {-221.91672982367527, -217.11835291683715}},
+		{{-216.96894264721362, -209.05497955577997}, {-207.7343618373132, -213.91696176747067}, {-211.09586349798278, -209.52349721989518}, {-217.491762326523, -208.22212533247119},
+		 {-216.61891359693078, -216.29700864080453}, {-214.83855491993421, -207.62476881760119}, {-214.39478498714743, -210.48603782532879}, {-218.48980365241718, -211.97451207776575}},
+		{{-212.45687145629682, -211.34423321183959}, {-215.28182081229906, -221.36010139047326}, {-215.69174699943343, -209.65318188178861}, {-218.7159062631128, -221.73394888589789},
+		 {-216.19379361025733, -217.44982333713344}, {-213.35244702171289, -214.67210638787122}, {-209.68413499179536, -216.60901486293253}, {-211.12196505909543, -222.24672488690555}},
+		{{-209.25976570988652, -208.06624482713758}, {-210.48991429178136, -210.50187302758303}, {-209.40835188081985, -210.89510308449539}, {-210.62796769787357, -212.51162707390068},
+		 {-210.10493284758317, -210.80435437518886}, {-211.90368669431774, -210.61642428971223}, {-209.40325335761474, -213.16022149191559}, {-208.17280253866849, -210.41031826268446}}
+	},
+	/* Function 17 */
+	{
+		{{-580.66279584867777, -641.7643515793784}, {-3561.549714612921, -3355.7104395672309}, {-2691.8579809859179, -2616.0778304587793}, {-1757.9270949344666, -1624.4844902755926},
+		 {-1264.8721270594503, -1261.904147193261}, {-1518.1502763156154, -1580.7380210715212}, {-1581.9930203102808, -1593.7107183753451}, {-1970.4595667510562, -2204.6388784028263}},
+		{{-1237.8638705345293, -1255.3438931250864}, {-12754.082252843535, -12358.337849581387}, {-9765.6417602860438, -9624.996735233759}, {-3983.4675813566291, -4040.6288961521241},
+		 {-3802.4976253403383, -3900.9976048000744}, {-3805.5428353571397, -3850.0208568492772}, {-3728.8945286517696, -3844.3588153614137}, {-5032.4910228369308, -4790.6662830711903}},
+		{{-2346.4905779234491, -2339.2140007134158}, {-21559.638214380633, -21079.43466327116}, {-18403.770143676618, -18168.400851006052}, {-8576.5414761118518, -9224.8461620874987},
+		 {-8060.0856607069536, -8134.3041230906247}, {-7015.1472338201584, -6738.2299612252527}, {-7802.6363677091258, -7460.4889954828514}, {-7506.27013523192, -7369.3706002699946}},
+		{{-4913.8203852388433, -4908.0180797918847}, {-42795.219297195566, -42636.987727841399}, {-41118.91293951196, -41034.410865866535}, {-17663.216043336179, -17499.507975223936},
+		 {-18349.7181461906, -18215.393446933853}, {-16826.72610685202, -16914.374009983785}, {-16281.582544217192, -16437.514185077162}, {-15253.68361117908, -15569.493837705113}}
+	},
+	/* Function 18 */
+	{
+		{{-692.07109767343684, -664.90386754257088}, {-3657.1727671367244, -3317.4891685322368}, {-2767.7030925622357, -2648.9019212016301}, {-1934.5213938341376, -1992.7669589645375},
+		 {-1183.3984290811509, -1125.2815876065135}, {-1719.0242225420577, -1913.8156780718423}, {-1865.2664113381011, -2180.0254726083112}, {-1062.8750503557003, -1154.4366420551601}},
+		{{-1414.7569959015318, -1494.1942801392099}, {-12902.519925384848, -13094.088276780109}, {-9855.6713598405149, -9906.7144805049611}, {-4981.508012849944, -4876.7085480924425},
+		 {-3939.9428918322633, -3822.5442983391722}, {-4112.1977397271594, -4264.6168064478643}, {-4919.4103957244797, -4570.4192092118465}, {-5003.7822009353276, -5070.8675030780669}},
+		{{-2493.2049558544968, -2428.857798390381}, {-21729.146354031669, -21575.40727951808}, {-18561.616977802696, -17940.938399822833}, {-6890.2984908499566, -6969.5796310716496},
+		 {-7972.6812016650993, -8117.4850067933821}, {-7760.0621658014461, -7804.9320660300609}, {-7097.0442005601126, -6704.4647847099059}, {-9449.9338671850492, -9430.1135535588855}},
+		{{-4982.9871820491098, -5158.8622723456501}, {-43037.097614048078, -42718.847697218713}, {-41336.927117701001, -40759.622541928919}, {-15575.115040982721, -15390.570112291152},
+		 {-15844.50190807776, -16029.046858840984}, {-19582.114798467617, -20300.312831189905}, {-15398.174550809572, -15101.676755854221}, {-21077.105475933044, -20893.379532523086}}
+	},
+	/* Function 19 */
+	{
+		{{-608363.7172470002, -27330543.660282627}, {-110170570.51462001, -170689635.25159982}, {-156716935.53488523, -75139106.709645271}, {-4567087.7577988962, -98577645.385893419},
+		 {-9605006.0510885008, -4420861.4776413366}, {-1545905.5168681613, -22311113.445216037}, {-21437224.896416739, -60606447.504356481}, {-23470128.088454615, -22171198.201102041}},
+		{{-1033103.4819016228, -5468801.4140942199}, {-276767885.12960637, -266092714.98172832}, {-434436155.03619516, -434308958.81180406}, {-66398369.530177847, -66635734.019030608},
+		 {-98606661.990033656, -98599850.666271597}, {-121735906.79679483, -121738851.91875756}, {-87905682.531169683, -87905579.250771135}, {-69758284.23521772, -69386588.411348879}},
+		{{-3364866.967518779, -3384797.4887270299}, {-434953585.08706194, -410801708.23002869}, {-1204494393.7654459, -1204954242.6315842}, {-306562215.56933993, -308974589.56129456},
+		 {-322453018.21913594, -322477203.34589171}, {-222519674.41912743, -223651481.00210103}, {-293531860.38752073, -291041413.68060893}, {-285013707.49821645, -287761397.3543272}},
+		{{-9919859.9896462113, -9501202.6083587836}, {-799608163.63683915, -789135234.3169564}, {-3218120944.0856199, -3217969011.4347286}, {-458146339.72670013, -454875402.38859099},
+		 {-324632797.57019955, -324606993.56931955}, {-846812675.90510368, -845103313.80526733}, {-359788421.88345397, -380577379.37750399}, {-231153783.03579724, -230994468.46522641}}
+	},
+	/* Function 20 */
+	{
+		{{-605, -605}, {-605, -605}, {-605.00000000000193, -605.00000000000011}, {-605, -605},
+		 {-605, -605}, {-605, -605}, {-605, -605}, {-605, -605}},
+		{{-615, -615}, {-615, -615}, {-615, -615}, {-615, -615},
+		 {-615, -615}, {-615, -615}, {-615, -615}, {-615, -615}},
+		{{-625, -625}, {-625, -625}, {-625, -625}, {-625, -625},
+		 {-625, -625}, {-625, -625}, {-625, -625}, {-625, -625}},
+		{{-650, -650}, {-650, -650}, {-650, -650}, {-650, -650},
+		 {-650, -650}, {-650, -650}, {-650, -650}, {-650, -650}}
+	},
+	/* Function 21 */
+	{
+		{{-4018.0190625895939, -6652.0422475024625}, {-4359943696719.7651, -68758105126350.609}, {-23670.633521046941, -23285.630355881858}, {-53987125.700095013, -284825348.75794488},
+		 {-1786.1089573242839, -8377.1176997924176}, {-3070.0375458038102, -2524.5932480803076}, {-8304.626155177968, -10329.344992605527}, {-8799.1462306811063, -14760.600909567609}},
+		{{-4040.6993985688187, -4025.5421261218462}, {-3298944212869707, -1719646584.9653933}, {-7711577.2693907395, -561025.72756662511}, {-11927.910914719552, -213365.82472774139},
+		 {-468941307.18469292, -5393509957546.79}, {-10710.299756067821, -11408.397562685474}, {-3191820.8206670093, -8235414.6323012821}, {-13015.195301048216, -12561.803667277283}},
+		{{-6703.2783633383197, -6688.4052709669704}, {-99557403.891210735, -2864856.8379547633}, {-6190221259650045, -2.8982897960971533e+17}, {-15688.062958249484, -16381.019068481677},
+		 {-50931.194492588787, -552801.33857136266}, {-15174.761811745375, -15174.293669451428}, {-16644.268909324059, -16982.88046044052}, {-16514.525888355947, -17257.443476935256}},
+		{{-10850.644828354927, -11237.473425386503}, {-263985531271636.59, -3925833139212214.5}, {-1.3770092374161021e+17, -25516252257082452}, {-36637.867280595427, -37920.229504834766},
+		 {-3250157.8277596422, -3203264.1503153406}, {-16082368381034460, -42437379175745712}, {-1728198001984.3984, -2400419320740.5005}, {-55810820966.024094, -165982931649.84073}}
+	},
+	/* Function 22 */
+	{
+		{{-4567.2665196603984, -4321.6505987394303}, {-5480.3350820839432, -5406.1103743224949}, {-5056.2330540595158, -5099.2007515762934}, {-4758.4564122072152, -4884.4913920850486},
+		 {-4644.3630773496971, -4317.2684307737081}, {-5772.7748746382567, -5829.3386039714806}, {-4153.8178121634173, -4077.8389902763192}, {-6001.8254105356209, -6056.7426196829438}},
+		{{-14178.921275223214, -13847.378922052347}, {-14671.70314486283, -14580.885251328511}, {-14248.708334216712, -14397.57087942062}, {-14735.539579394959, -15027.402751421778},
+		 {-12000.141171180048, -12338.402188126238}, {-12856.414468035468, -13033.015392032654}, {-13723.479374362647, -13697.729074063034}, {-13442.695246573567, -13960.387107748649}},
+		{{-20707.276545659821, -20646.611703228795}, {-24605.135326661824, -23718.051467832847}, {-20605.303603575485, -20803.472742272188}, {-20851.410894497847, -20987.765565491543},
+		 {-21516.718465418653, -21516.670269038761}, {-21781.56811803368, -21370.436800856449}, {-21592.11375436173, -21586.747696036658}, {-21300.058125057243, -21334.033600914241}},
+		{{-41654.568224837043, -41522.843158362884}, {-48255.449278181506, -48432.770645153505}, {-39569.602028249996, -39693.278163969997}, {-41996.874563625846, -41798.021243228235},
+		 {-41881.209348978024, -42169.389522031757}, {-42882.137189134315, -42681.51330960924}, {-40170.013996240268, -39757.243338556495}, {-41001.990553888296, -40872.217089846039}}
+	},
+	/* Function 23 */
+	{
+		{{-5797.5807772783173, -5731.9659225483256}, {-5642.606662501652, -4971.1302792991046}, {-5472.8973332325868, -5362.7572369039553}, {-5259.6221106807352, -5211.1070715746437},
+		 {-5129.6040707332631, -5103.2390101412448}, {-5576.2149055901291, -5194.4667599909226}, {-5162.3561737415639, -4439.6281402641653}, {-4942.0925477986602, -5056.0804152792907}},
+		{{-12533.698121562355, -12932.307021974857}, {-13525.049878010543, -15335.355897038186}, {-12832.889037309904, -11606.122277566328}, {-13977.462976106557, -12172.048350758709},
+		 {-11585.319855169924, -14459.49242729943}, {-14245.646869643315, -13059.679877658917}, {-12621.185075546571, -13269.673598488771}, {-11713.08734247127, -12135.102873282758}},
+		{{-20730.400590696212, -21460.119367748717}, {-24240.91923039528, -22077.108823126029}, {-23142.02834324912, -22494.201563050392}, {-22082.530950477329, -20700.155704658777},
+		 {-20609.402396225007, -22101.947372443741}, {-21957.994451211231, -21164.112795225039}, {-19663.332678773313, -20469.654051030455}, {-20835.382408631856, -21011.642724744903}},
+		{{-38468.253143920985, -41794.880539004924}, {-42920.244701167481, -44559.595421271675}, {-42789.887354271748, -42586.652734834177}, {-42144.502758089147, -42566.312060633478},
+		 {-42260.224248739047, -40635.425180161423}, {-43440.192521322853, -43322.611383540294}, {-40279.818056526492, -41674.274098016067}, {-40854.139798699762, -40895.966597661158}}
+	},
+	/* Function 24 */
+	{
+		{{-1441.345924627054, -1595.1680420358718}, {-1246.630387260959, -1277.5474145315702}, {-2962.8896576885827, -2650.3570195115135}, {-1697.2987121035812, -1856.9477950655112},
+		 {-2619.1972042910038, -2619.1972042910038}, {-1948.4225284916167, -2089.755843716769}, {-1504.1166567212549, -1925.2008396331548}, {-1632.7264615601994, -1425.3961211160236}},
+		{{-3248.1000532276635, -2904.5099227976202}, {-4191.6799802715941, -2943.4991827937665}, {-4119.3520237803059, -4497.4805140011695}, {-3972.4997914563023, -3764.2289055579909},
+		 {-3426.6039201678182, -3379.7677296785459}, {-2485.2483781837782, -2996.5379367709893}, {-3654.2434038160927, -3882.2419667705426}, {-3221.6630327314074, -3845.4684949100415}},
+		{{-2692.940790229507, -2672.5310491502751}, {-7760.5694584919238, -6848.5754042760309}, {-4817.3078634161211, -4433.565811699621}, {-4078.6802226848699, -3935.7780194740953},
+		 {-5964.7907057565426, -5828.1946344732605}, {-2513.5423422779663, -2638.0877882909331}, {-4968.7353110806434, -5237.3919728632472}, {-4822.6850464803556, -4417.481372540642}},
+		{{-4885.6351581079207, -4912.877975852608}, {-23202.776347940184, -23478.81396806008}, {-30576.745530775781, -28546.52970980393}, {-8878.6912641312119, -8956.1362404447082},
+		 {-7527.0859290131884, -7316.1486733728689}, {-12380.883713640469, -11762.701282207885}, {-11481.855339184629, -10508.193585427643}, {-13277.121231426803, -14202.457661344062}}
+	},
+	/* Function 25 */
+	{
+		{{-1389.9980851121418, -1415.0909964365273}, {-1339.3076258651718, -1354.9904998804791}, {-1829.3221170251998, -1763.5079327706128}, {-1401.3521391691822, -1435.2333191601083},
+		 {-1488.0698913965757, -1460.7418742175214}, {-1439.4196333947623, -1425.8084934272113}, {-1499.6399401528386, -1414.2972963614429}, {-1393.0675097163983, -1471.8495554343349}},
+		{{-1820.8979043270315, -1800.1921432188374}, {-1539.1125246037914, -1547.943480560828}, {-1899.2146030763583, -1996.0701993942862}, {-2196.5119127785815, -2149.2523124023373},
+		 {-1878.1826080038866, -1941.4730930790661}, {-1915.1738747127818, -1938.6736602497319}, {-1631.6960246994465, -1634.0163545686282}, {-1867.8247585509273, -1862.6780318975216}},
+		{{-1932.7361668399067, -2019.3338919812086}, {-1659.0794505153731, -1662.8344927396627}, {-1726.159716135759, -1716.119630228887}, {-1954.5829772456127, -1954.0710151141739},
+		 {-3180.6151015015985, -3249.8780505954323}, {-2356.3623333384421, -2261.6653866665988}, {-2158.100691207635, -2154.5836423892888}, {-1767.6754010792401, -1815.8725507163349}},
+		{{-3083.1045498936255, -3183.0958630568593}, {-2393.6695893699944, -2378.0066756754527}, {-2828.7446758160904, -2716.9734697590575}, {-3848.5796144549236, -3880.9903560449975},
+		 {-3768.6907001448867, -3705.6381229351246}, {-4540.4957120269628, -4565.2980152892214}, {-3975.99766393356, -3929.6192925712699}, {-3330.952862755893, -3169.64388914863}}
+	},
+	/* Function 26 */
+	{
+		{{-1701.1980079332257, -2142.3397447895836}, {-102208.83524971259, -98540.85780941874}, {-3367.1531685242339, -2921.643694354851}, {-1547.2618844355513, -1546.9196245338612},
+		 {-2010.1780617830061, -1677.9809789089827}, {-1900.4395096688504, -36436.561875935127}, {-2494.5897755119749, -2555.9979589823179}, {-2401.4885022714179, -2229.3096337080306}},
+		{{-18528.295381826036, -17128.881526825513}, {-23713.940547268074, -5358.2648655078292}, {-4185.3700791173778, -4221.1087179269725}, {-3804.406155470343, -4106.5920862707135},
+		 {-1811.266410495849, -2646.2481145562597}, {-46264.08351340003, -29382.063637017251}, {-16805.102287987731, -36691.350635360875}, {-1680.8016277582046, -1720.3724999695769}},
+		{{-3557.9491000737075, -4968.8389922417309}, {-620095.8064325474, -615617.14301224309}, {-7573.1686361611028, -6947.2205737880449}, {-3238.6933763965321, -3043.5540977574301},
+		 {-3872.1126179589573, -11012.234698591996}, {-2792.7737438888412, -2812.6289749343646}, {-12529.102203233762, -3978.8055225758781}, {-6788.9579898682059, -5848.3004399641995}},
+		{{-84130.848723134171, -64965.972171744732}, {-38618.44999634588, -52153.16448175098}, {-1719022.7241109414, -1812608.4618015224}, {-59653.737857764521, -49832.654678268467},
+		 {-393844.00128503551, -398440.53182696144}, {-256983.28419925907, -243158.41033212005}, {-5220.3068057476376, -5318.8299517498108}, {-24997.926641059224, -10938.468738078373}}
+	},
+	/* Function 27 */
+	{
+		{{-3295.7938157423305, -4235.5708635200499}, {-11906.094287370555, -11774.473232291515}, {-2310.5724211562006, -2486.3274708390645}, {-2076.3430926967449, -1997.8085204162994},
+		 {-6163.426037281597, -6370.0632090102044}, {-4780.2605303693463, -5698.1297830085368}, {-2180.7411175669768, -2058.5870805576515}, {-2177.5670189362713, -2787.1593915751428}},
+		{{-5024.3132462231843, -4905.3387320186384}, {-23335.043413949959, -24501.745947558276}, {-11494.640761015578, -15426.527447432671}, {-9237.3715887758208, -10110.50088823194},
+		 {-7827.0932942191184, -7741.9782540544256}, {-7940.4597443668208, -8788.7781056069798}, {-9205.4705602912472, -9824.1090406758813}, {-12802.346699035101, -11234.116973973474}},
+		{{-7057.5064727174922, -7116.9197749296709}, {-35255.594628271392, -32615.781497984943}, {-12188.044356725588, -22101.319707454502}, {-4227.9407164476233, -4673.8015604104176},
+		 {-9885.8884006849166, -12653.696917832509}, {-6296.5589152649482, -6403.8965475222913}, {-7472.3119288099915, -8540.2583527038078}, {-15047.309085963525, -15114.936251414214}},
+		{{-16195.294197537161, -16233.381853817928}, {-40877.235130891793, -34984.088857367176}, {-98627.038268285964, -97819.788097604731}, {-32477.037081764014, -32371.238864684543},
+		 {-38485.49409703735, -38450.445820199813}, {-49590.269021897868, -51150.777651228396}, {-42017.614551743172, -42436.786283312147}, {-49926.832986237765, -50288.330682308319}}
+	},
+	/* Function 28 */
+	{
+		{{-5813.2146771092357, -34016.682064014618}, {-11198.685923375269, -10872.944611635316}, {-3043377067.814405, -1090247655.1993132}, {-27039.882505207162, -5357.2059611766799},
+		 {-200899.00751252327, -29533.586384158622}, {-4111.3578132831317, -4292.3726324898344}, {-9775.9127582587571, -10600.819276174201}, {-5693.0284350743914, -7115.9757730686288}},
+		{{-19687.498836442024, -15097.284106477848}, {-142759548.49676824, -411158528.45929968}, {-896589374.33073306, -1095131120.7803071}, {-151437162.12114054, -137439272.4073171},
+		 {-115753461.427837, -27166790.777307812}, {-186513124.02435261, -165226335.22102824}, {-1050190.3550913993, -827934.75254749006}, {-174902.3819407518, -126875.82228203643}},
+		{{-12104074.622738035, -12643447.538389152}, {-67737.558522847627, -143420.5220198961}, {-3475110880648.4658, -2748472587241.7036}, {-217063544.62322569, -21689150.698696949},
+		 {-21412882.779398959, -5209969.0573590584}, {-272822980.92954051, -434573982.54057741}, {-43140138771.948296, -45388962213.864075}, {-357088402.2800557, -17368636.097780354}},
+		{{-12193894.909635194, -65329075.559631407}, {-2226012665.508585, -17864108298.886326}, {-22980358700059.926, -33240000813083.16}, {-2063098183.224072, -646464546.35739505},
+		 {-74383611.744949564, -31521472.596833561}, {-251890439.6613878, -266391202.12175974}, {-8401704.7189783137, -5446434.6183210118}, {-1308594.9172150737, -2436845.583879347}}
+	}
+};
+
+#endif //TESTS_FUNCREFERENCE_H
@@ -0,0 +1,119 @@
+/**
+ * PrecisionRankingTest.cpp
+ *
+ * Validation of the mixed precision (see Func::setPrecision): for every function it evaluates the
+ * same solutions with an instance in double precision and another one in mixed precision, and
+ * counts the pairs of solutions whose order differs between both (the search only compares
+ * fitness values, so this is the error which matters). It uses random solutions and solutions
+ * near the optimum (the shift of the function, moved a few units in every parameter).
+ *
+ * It fails if any function disagrees in more than MAX_DISAGREEMENT of the pairs. Rotated Ackley
+ * (8) does not offer the mixed precision, so both of its instances are in double precision.
+ *
+ * It is run from the directory which contains input_data. From the root of the repository:
+ *   g++ -std=c++17 -O2 -Iinclude tests/PrecisionRankingTest.cpp RPOInstance.cpp RPOSolution.cpp -o PrecisionRankingTest
+ *   ./PrecisionRankingTest [solutions]
+ *
+ *
+ * @author Andrei Staradubets astarodubetc@mail.ru
+ */
+
+#include <RPOInstance.h>
+#include <RPOSolution.h>
+#include <FuncData.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+#define MAX_DISAGREEMENT 0.001 //Largest fraction of the pairs of solutions ordered differently
+#define SHIFT_BLOCKS 10 //Shifts read by Func (the registry of FuncData keeps the first load of every file)
+
+/**
+ * Function which returns the fraction of the pairs of solutions which are ordered differently by
+ * two vectors of fitness values (a tie in one of them and not in the other is a disagreement)
+ */
+static double disagreement(const vector<double> &a, const vector<double> &b){
+	size_t n=a.size(), numPairs=0, numDifferent=0;
+	for (size_t i=0; i<n; i++)
+		for (size_t j=i+1; j<n; j++)
+		{
+			int orderA=(a[i]<a[j])?-1:(a[i]>a[j])?1:0;
+			int orderB=(b[i]<b[j])?-1:(b[i]>b[j])?1:0;
+			numPairs++;
+			if (orderA!=orderB)
+				numDifferent++;
+		}
+	return (numPairs>0)?(double) numDifferent/numPairs:0.0;
+}
+
+/**
+ * Function which evaluates the solutions with both instances
+ */
+static void evaluate(RPOInstance &doubleInstance, RPOInstance &mixedInstance, const vector<vector<int> > &solutions,
+		vector<double> &doubleFitness, vector<double> &mixedFitness){
+	RPOSolution sol(doubleInstance);
+	doubleFitness.clear();
+	mixedFitness.clear();
+	for (const vector<int> &parameters : solutions)
+	{
+		for (size_t i=0; i<parameters.size(); i++)
+			sol.ChangeParameterTo(i, parameters[i]);
+		doubleFitness.push_back(doubleInstance.getFitness(sol));
+		mixedFitness.push_back(mixedInstance.getFitness(sol));
+	}
+}
+
+int main(int argc, char **argv){
+	int numSolutions=(argc>1)?atoi(argv[1]):120;
+	int dimensions[]={10, 30, 50, 100};
+	double worstRandom=0, worstNear=0;
+	bool failed=false;
+
+	printf("Pairs of solutions ordered differently in double and mixed precision (%d solutions)\n", numSolutions);
+	printf("%4s %5s %10s %10s\n", "F", "D", "random", "near opt.");
+
+	for (int fn=1; fn<=28; fn++)
+		for (int nx : dimensions)
+		{
+			RPOInstance doubleInstance(nx, fn), mixedInstance(nx, fn);
+			mixedInstance.setPrecision(RPOInstance::ObjectiveType::PRECISION_MIXED);
+			const double *optimum=FuncData::shifts(nx, SHIFT_BLOCKS);
+			mt19937_64 generator(1000*fn+nx);
+			vector<vector<int> > randomSolutions(numSolutions, vector<int>(nx)), nearSolutions(numSolutions, vector<int>(nx));
+			vector<double> doubleFitness, mixedFitness;
+
+			for (int s=0; s<numSolutions; s++)
+				for (int i=0; i<nx; i++)
+				{
+					randomSolutions[s][i]=(int) (generator()%201);
+					int value=(int) lround(optimum[i])+100+(int) (generator()%7)-3;
+					nearSolutions[s][i]=min(200, max(0, value));
+				}
+
+			evaluate(doubleInstance, mixedInstance, randomSolutions, doubleFitness, mixedFitness);
+			double random=disagreement(doubleFitness, mixedFitness);
+			evaluate(doubleInstance, mixedInstance, nearSolutions, doubleFitness, mixedFitness);
+			double near=disagreement(doubleFitness, mixedFitness);
+
+			worstRandom=max(worstRandom, random);
+			worstNear=max(worstNear, near);
+			bool ok=(random<=MAX_DISAGREEMENT && near<=MAX_DISAGREEMENT);
+			if (!ok)
+				failed=true;
+			if (!ok || random>0 || near>0)
+				printf("%4d %5d %9.4f%% %9.4f%%%s\n", fn, nx, 100*random, 100*near, ok?"":"  FAILED");
+		}
+
+	printf("Largest disagreement: %.4f%% of the pairs of random solutions, %.4f%% near the optimum\n", 100*worstRandom, 100*worstNear);
+	if (failed)
+	{
+		printf("Some functions disagree in more than %.4f%% of the pairs\n", 100*MAX_DISAGREEMENT);
+		return 1;
+	}
+	return 0;
+}